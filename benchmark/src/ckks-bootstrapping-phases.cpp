@@ -0,0 +1,192 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2025, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Per-phase timing of CKKS bootstrapping across ring dimensions, level budgets, slot counts, scaling techniques
+  and thread counts. The phases are measured inside EvalBootstrap with the library performance counters and are
+  reported as benchmark counters, so --benchmark_format=json (or --benchmark_out) gives machine-readable results.
+ */
+
+#include "benchmark/benchmark.h"
+#include "cryptocontext.h"
+#include "gen-cryptocontext.h"
+#include "scheme/ckksrns/ckksrns-fhe.h"
+#include "scheme/ckksrns/gen-cryptocontext-ckksrns.h"
+#include "utils/parallel.h"
+#include "utils/profiler.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <sys/resource.h>
+#endif
+
+#include <cstdint>
+#include <vector>
+
+using namespace lbcrypto;
+
+struct boot_phase_config {
+    uint32_t ringDim;
+    uint32_t slots;
+    uint32_t dcrtBits;
+    uint32_t firstMod;
+    uint32_t lvlsAfter;
+    std::vector<uint32_t> lvlb;
+    SecretKeyDist skdst;
+    ScalingTechnique stech;
+};
+
+// clang-format off
+[[maybe_unused]] std::vector<boot_phase_config> boot_phase_configs = {
+    // ringDm,   slots, dcrtBits, firstMod, lvlsAfter,   lvlb,           skdst,           stech
+    // ring dimension
+    { 1 << 12, 1 << 11,       59,       60,        10, {3, 3}, UNIFORM_TERNARY,    FLEXIBLEAUTO},
+    { 1 << 13, 1 << 12,       59,       60,        10, {3, 3}, UNIFORM_TERNARY,    FLEXIBLEAUTO},
+    { 1 << 14, 1 << 13,       59,       60,        10, {3, 3}, UNIFORM_TERNARY,    FLEXIBLEAUTO},
+    { 1 << 15, 1 << 14,       59,       60,        10, {3, 3}, UNIFORM_TERNARY,    FLEXIBLEAUTO},
+    { 1 << 16, 1 << 15,       59,       60,        10, {3, 3}, UNIFORM_TERNARY,    FLEXIBLEAUTO},
+    // level budget
+    { 1 << 14, 1 << 13,       59,       60,        10, {2, 2}, UNIFORM_TERNARY,    FLEXIBLEAUTO},
+    { 1 << 14, 1 << 13,       59,       60,        10, {4, 4}, UNIFORM_TERNARY,    FLEXIBLEAUTO},
+    // sparse packing
+    { 1 << 14,  1 << 4,       59,       60,        10, {1, 1}, UNIFORM_TERNARY,    FLEXIBLEAUTO},
+    { 1 << 14,  1 << 8,       59,       60,        10, {2, 2}, UNIFORM_TERNARY,    FLEXIBLEAUTO},
+    { 1 << 14, 1 << 11,       59,       60,        10, {3, 3}, UNIFORM_TERNARY,    FLEXIBLEAUTO},
+    // scaling technique and secret distribution
+    { 1 << 14, 1 << 13,       59,       60,        10, {3, 3}, UNIFORM_TERNARY,     FIXEDMANUAL},
+    { 1 << 14, 1 << 13,       59,       60,        10, {3, 3}, UNIFORM_TERNARY,       FIXEDAUTO},
+    { 1 << 14, 1 << 13,       59,       60,        10, {3, 3}, UNIFORM_TERNARY, FLEXIBLEAUTOEXT},
+    { 1 << 14, 1 << 13,       59,       60,        10, {3, 3},  SPARSE_TERNARY,    FLEXIBLEAUTO},
+};
+// clang-format on
+
+// peak resident set size of the process in MB; 0 where it is not available
+static double PeakMemoryMB() {
+#if defined(__unix__) || defined(__APPLE__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+    #if defined(__APPLE__)
+    return usage.ru_maxrss / (1024.0 * 1024.0);
+    #else
+    return usage.ru_maxrss / 1024.0;
+    #endif
+#else
+    return 0;
+#endif
+}
+
+[[maybe_unused]] static void BootPhaseConfigs(benchmark::internal::Benchmark* b) {
+    const int maxThreads = OpenFHEParallelControls.GetMachineThreads();
+    b->ArgNames({"Config", "Threads"});
+    for (uint32_t i = 0; i < boot_phase_configs.size(); ++i) {
+        for (int threads = 1; threads < maxThreads; threads <<= 1)
+            b->Args({i, threads});
+        b->Args({i, maxThreads});
+    }
+}
+
+[[maybe_unused]] static void CKKSBootPhases(benchmark::State& state) {
+    auto t = boot_phase_configs[state.range(0)];
+
+    // the smaller ring dimensions are not secure and are only used to see how the phases scale
+    CCParams<CryptoContextCKKSRNS> parameters;
+    parameters.SetSecurityLevel(HEStd_NotSet);
+    parameters.SetRingDim(t.ringDim);
+    parameters.SetScalingModSize(t.dcrtBits);
+    parameters.SetFirstModSize(t.firstMod);
+    parameters.SetSecretKeyDist(t.skdst);
+    parameters.SetScalingTechnique(t.stech);
+    parameters.SetKeySwitchTechnique(HYBRID);
+    uint32_t depth = t.lvlsAfter + FHECKKSRNS::GetBootstrapDepth(t.lvlb, t.skdst);
+    parameters.SetMultiplicativeDepth(depth);
+
+    auto cc = GenCryptoContext(parameters);
+    cc->Enable(PKE);
+    cc->Enable(KEYSWITCH);
+    cc->Enable(LEVELEDSHE);
+    cc->Enable(ADVANCEDSHE);
+    cc->Enable(FHE);
+
+    cc->EvalBootstrapSetup(t.lvlb, {0, 0}, t.slots);
+
+    auto keyPair = cc->KeyGen();
+    cc->EvalMultKeyGen(keyPair.secretKey);
+    cc->EvalBootstrapKeyGen(keyPair.secretKey, t.slots);
+
+    std::vector<double> x = {0.25, 0.5, 0.75, 1.0, 2.0, 3.0, 4.0, 5.0};
+
+    auto ptxt = cc->MakeCKKSPackedPlaintext(x, 1, depth - 1, nullptr, t.slots);
+    ptxt->SetLength(t.slots);
+
+    auto ctxt = cc->Encrypt(keyPair.publicKey, ptxt);
+
+    const int threads = static_cast<int>(state.range(1));
+    OpenFHEParallelControls.SetNumThreads(threads);
+
+    // the first bootstrap fills the lazily computed tables and is not measured
+    auto ctxtAfter = cc->EvalBootstrap(ctxt);
+
+    const bool wasEnabled = PerfCounters::IsEnabled();
+    PerfCounters::Enable();
+    PerfCounters::Reset();
+
+    for (auto _ : state)
+        ctxtAfter = cc->EvalBootstrap(ctxt);
+
+    auto ms = [](PerfOp op) {
+        return benchmark::Counter(PerfCounters::Get(op).wallTimeNs / 1e6, benchmark::Counter::kAvgIterations);
+    };
+    auto boot    = PerfCounters::Get(PerfOp::EVAL_BOOTSTRAP);
+    auto evalMod = PerfCounters::Get(PerfOp::BOOT_EVAL_MOD);
+    auto dblAng  = PerfCounters::Get(PerfOp::BOOT_DOUBLE_ANGLE);
+
+    state.counters["Threads"]           = threads;
+    state.counters["ModRaise_ms"]       = ms(PerfOp::BOOT_MOD_RAISE);
+    state.counters["CoeffsToSlots_ms"]  = ms(PerfOp::BOOT_COEFFS_TO_SLOTS);
+    state.counters["EvalChebyshev_ms"]  = benchmark::Counter((evalMod.wallTimeNs - dblAng.wallTimeNs) / 1e6,
+                                                             benchmark::Counter::kAvgIterations);
+    state.counters["DoubleAngle_ms"]    = ms(PerfOp::BOOT_DOUBLE_ANGLE);
+    state.counters["SlotsToCoeffs_ms"]  = ms(PerfOp::BOOT_SLOTS_TO_COEFFS);
+    state.counters["KeySwitches"]       = benchmark::Counter(boot.keySwitches, benchmark::Counter::kAvgIterations);
+    state.counters["NTTs"]              = benchmark::Counter(boot.ntts, benchmark::Counter::kAvgIterations);
+    state.counters["AllocatedMB"]       = benchmark::Counter(boot.bytesAllocated / (1024.0 * 1024.0),
+                                                             benchmark::Counter::kAvgIterations);
+    state.counters["ThreadUtilization"] = boot.ThreadUtilization();
+    state.counters["PeakMemoryMB"]      = PeakMemoryMB();
+
+    PerfCounters::Enable(wasEnabled);
+    OpenFHEParallelControls.SetNumThreads(OpenFHEParallelControls.GetMachineThreads());
+    cc->ClearStaticMapsAndVectors();
+}
+
+BENCHMARK(CKKSBootPhases)->Unit(benchmark::kMillisecond)->Iterations(4)->Apply(BootPhaseConfigs);
+
+BENCHMARK_MAIN();
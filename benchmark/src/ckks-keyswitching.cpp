@@ -0,0 +1,295 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2025, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Key-switching kernels (ModUp, key inner product, ModDown) and hoisted versus non-hoisted rotations for BV and
+  HYBRID key switching across ring dimensions, numbers of digits and towers, first-modulus sizes and thread counts
+ */
+
+#include "benchmark/benchmark.h"
+#include "cryptocontext.h"
+#include "gen-cryptocontext.h"
+#include "scheme/ckksrns/gen-cryptocontext-ckksrns.h"
+#include "utils/parallel.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace lbcrypto;
+
+struct ks_config {
+    KeySwitchTechnique ksTech;
+    uint32_t ringDim;
+    uint32_t numDigits;  // numLargeDigits (dnum) for HYBRID, digit size in bits for BV (0: one digit per tower)
+    uint32_t depth;
+    uint32_t firstMod;
+};
+
+// clang-format off
+[[maybe_unused]] std::vector<ks_config> ks_configs = {
+    //  ksTech,  ringDim, numDigits, depth, firstMod
+    // HYBRID: dnum sweep
+    {   HYBRID,  1 << 15,         1,    20,       60},
+    {   HYBRID,  1 << 15,         2,    20,       60},
+    {   HYBRID,  1 << 15,         3,    20,       60},
+    {   HYBRID,  1 << 15,         4,    20,       60},
+    {   HYBRID,  1 << 15,         7,    20,       60},
+    {   HYBRID,  1 << 15,        21,    20,       60},
+    // HYBRID: ring dimension
+    {   HYBRID,  1 << 13,         3,    20,       60},
+    {   HYBRID,  1 << 14,         3,    20,       60},
+    {   HYBRID,  1 << 16,         3,    20,       60},
+    // HYBRID: number of towers and first modulus
+    {   HYBRID,  1 << 15,         3,     5,       60},
+    {   HYBRID,  1 << 15,         3,    10,       60},
+    {   HYBRID,  1 << 15,         3,    30,       60},
+    {   HYBRID,  1 << 15,         3,    20,       50},
+    // BV: digit size sweep
+    {       BV,  1 << 15,         0,    20,       60},
+    {       BV,  1 << 15,        30,    20,       60},
+    {       BV,  1 << 15,        20,    20,       60},
+    // BV: ring dimension and number of towers
+    {       BV,  1 << 14,         0,    20,       60},
+    {       BV,  1 << 16,         0,    20,       60},
+    {       BV,  1 << 15,         0,    10,       60},
+};
+// clang-format on
+
+// number of rotations in the hoisted versus non-hoisted comparison
+constexpr uint32_t ROTATIONS[] = {4, 16};
+
+static void AddThreadArgs(benchmark::internal::Benchmark* b, std::vector<int64_t> args) {
+    const int maxThreads = OpenFHEParallelControls.GetMachineThreads();
+    args.push_back(0);
+    for (int threads = 1; threads < maxThreads; threads <<= 1) {
+        args.back() = threads;
+        b->Args(args);
+    }
+    args.back() = maxThreads;
+    b->Args(args);
+}
+
+[[maybe_unused]] static void KSConfigs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"Config", "Threads"});
+    for (uint32_t i = 0; i < ks_configs.size(); ++i)
+        AddThreadArgs(b, {i});
+}
+
+[[maybe_unused]] static void RotationConfigs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"Config", "K", "Threads"});
+    for (uint32_t i = 0; i < ks_configs.size(); ++i) {
+        for (uint32_t k : ROTATIONS)
+            AddThreadArgs(b, {i, k});
+    }
+}
+
+struct KSContext {
+    CryptoContext<DCRTPoly> cc;
+    KeyPair<DCRTPoly> keyPair;
+    EvalKey<DCRTPoly> evalKey;
+    Ciphertext<DCRTPoly> ciphertext;
+};
+
+// the smaller ring dimensions are not secure and are only used to see how the kernels scale
+static KSContext GenerateKSContext(const ks_config& t, const std::vector<int32_t>& indices = {}) {
+    CCParams<CryptoContextCKKSRNS> parameters;
+    parameters.SetSecurityLevel(HEStd_NotSet);
+    parameters.SetRingDim(t.ringDim);
+    parameters.SetMultiplicativeDepth(t.depth);
+    parameters.SetScalingModSize(t.firstMod - 10);
+    parameters.SetFirstModSize(t.firstMod);
+    parameters.SetKeySwitchTechnique(t.ksTech);
+    if (t.ksTech == HYBRID)
+        parameters.SetNumLargeDigits(t.numDigits);
+    else
+        parameters.SetDigitSize(t.numDigits);
+    parameters.SetScalingTechnique(FIXEDMANUAL);
+
+    KSContext ctx;
+    ctx.cc = GenCryptoContext(parameters);
+    ctx.cc->Enable(PKE);
+    ctx.cc->Enable(KEYSWITCH);
+    ctx.cc->Enable(LEVELEDSHE);
+
+    ctx.keyPair = ctx.cc->KeyGen();
+    ctx.evalKey = ctx.cc->KeySwitchGen(ctx.keyPair.secretKey, ctx.cc->KeyGen().secretKey);
+    if (!indices.empty())
+        ctx.cc->EvalRotateKeyGen(ctx.keyPair.secretKey, indices);
+
+    std::vector<double> x = {0.25, 0.5, 0.75, 1.0, 2.0, 3.0, 4.0, 5.0};
+    ctx.ciphertext        = ctx.cc->Encrypt(ctx.keyPair.publicKey, ctx.cc->MakeCKKSPackedPlaintext(x));
+    return ctx;
+}
+
+// sets the OpenMP thread count for the duration of a benchmark
+class ThreadLimit {
+public:
+    explicit ThreadLimit(benchmark::State& state, int threadArg) {
+        const int threads = static_cast<int>(state.range(threadArg));
+        OpenFHEParallelControls.SetNumThreads(threads);
+        state.counters["Threads"] = threads;
+    }
+    ~ThreadLimit() {
+        OpenFHEParallelControls.SetNumThreads(OpenFHEParallelControls.GetMachineThreads());
+    }
+};
+
+static void ReportConfig(benchmark::State& state, const KSContext& ctx) {
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersRNS>(ctx.cc->GetCryptoParameters());
+    state.counters["Towers"] = ctx.ciphertext->GetElements()[0].GetNumOfElements();
+    state.counters["Digits"] = (cryptoParams->GetKeySwitchTechnique() == HYBRID) ?
+                                   cryptoParams->GetNumPartQ() :
+                                   ctx.evalKey->GetAVector().size();
+}
+
+[[maybe_unused]] static void KeySwitchModUp(benchmark::State& state) {
+    auto ctx = GenerateKSContext(ks_configs[state.range(0)]);
+    ThreadLimit limit(state, 1);
+    ReportConfig(state, ctx);
+
+    auto algo       = ctx.cc->GetScheme();
+    const auto& c1  = ctx.ciphertext->GetElements()[1];
+    auto cryptoBase = ctx.cc->GetCryptoParameters();
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(algo->EvalKeySwitchPrecomputeCore(c1, cryptoBase));
+
+    ctx.cc->ClearStaticMapsAndVectors();
+}
+
+[[maybe_unused]] static void KeySwitchInnerProduct(benchmark::State& state) {
+    auto t   = ks_configs[state.range(0)];
+    auto ctx = GenerateKSContext(t);
+    ThreadLimit limit(state, 1);
+    ReportConfig(state, ctx);
+
+    auto algo      = ctx.cc->GetScheme();
+    const auto& c1 = ctx.ciphertext->GetElements()[1];
+    auto digits    = algo->EvalKeySwitchPrecomputeCore(c1, ctx.cc->GetCryptoParameters());
+    auto paramsQl  = c1.GetParams();
+
+    // BV has no extended basis, so its inner product already produces the result in Q
+    for (auto _ : state) {
+        if (t.ksTech == HYBRID)
+            benchmark::DoNotOptimize(algo->EvalFastKeySwitchCoreExt(digits, ctx.evalKey, paramsQl));
+        else
+            benchmark::DoNotOptimize(algo->EvalFastKeySwitchCore(digits, ctx.evalKey, paramsQl));
+    }
+
+    ctx.cc->ClearStaticMapsAndVectors();
+}
+
+[[maybe_unused]] static void KeySwitchModDown(benchmark::State& state) {
+    auto t = ks_configs[state.range(0)];
+    if (t.ksTech != HYBRID) {
+        state.SkipWithError("BV key switching has no ModDown step");
+        return;
+    }
+
+    auto ctx = GenerateKSContext(t);
+    ThreadLimit limit(state, 1);
+    ReportConfig(state, ctx);
+
+    auto algo      = ctx.cc->GetScheme();
+    const auto& c1 = ctx.ciphertext->GetElements()[1];
+    auto digits    = algo->EvalKeySwitchPrecomputeCore(c1, ctx.cc->GetCryptoParameters());
+    auto ext       = algo->EvalFastKeySwitchCoreExt(digits, ctx.evalKey, c1.GetParams());
+
+    auto ciphertextExt = ctx.ciphertext->CloneEmpty();
+    ciphertextExt->SetElements(std::move(*ext));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(algo->KeySwitchDown(ciphertextExt));
+
+    ctx.cc->ClearStaticMapsAndVectors();
+}
+
+[[maybe_unused]] static void KeySwitchFull(benchmark::State& state) {
+    auto ctx = GenerateKSContext(ks_configs[state.range(0)]);
+    ThreadLimit limit(state, 1);
+    ReportConfig(state, ctx);
+
+    auto algo = ctx.cc->GetScheme();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(algo->KeySwitch(ctx.ciphertext, ctx.evalKey));
+
+    ctx.cc->ClearStaticMapsAndVectors();
+}
+
+[[maybe_unused]] static void RotateNonHoisted(benchmark::State& state) {
+    const uint32_t k = state.range(1);
+    std::vector<int32_t> indices(k);
+    for (uint32_t i = 0; i < k; ++i)
+        indices[i] = i + 1;
+
+    auto ctx = GenerateKSContext(ks_configs[state.range(0)], indices);
+    ThreadLimit limit(state, 2);
+    ReportConfig(state, ctx);
+
+    for (auto _ : state) {
+        for (auto index : indices)
+            benchmark::DoNotOptimize(ctx.cc->EvalRotate(ctx.ciphertext, index));
+    }
+    state.SetItemsProcessed(state.iterations() * k);
+
+    ctx.cc->ClearStaticMapsAndVectors();
+}
+
+[[maybe_unused]] static void RotateHoisted(benchmark::State& state) {
+    const uint32_t k = state.range(1);
+    std::vector<int32_t> indices(k);
+    for (uint32_t i = 0; i < k; ++i)
+        indices[i] = i + 1;
+
+    auto ctx = GenerateKSContext(ks_configs[state.range(0)], indices);
+    ThreadLimit limit(state, 2);
+    ReportConfig(state, ctx);
+
+    const uint32_t m = ctx.cc->GetCyclotomicOrder();
+    for (auto _ : state) {
+        auto digits = ctx.cc->EvalFastRotationPrecompute(ctx.ciphertext);
+        for (auto index : indices)
+            benchmark::DoNotOptimize(ctx.cc->EvalFastRotation(ctx.ciphertext, index, m, digits));
+    }
+    state.SetItemsProcessed(state.iterations() * k);
+
+    ctx.cc->ClearStaticMapsAndVectors();
+}
+
+BENCHMARK(KeySwitchModUp)->Unit(benchmark::kMicrosecond)->Apply(KSConfigs);
+BENCHMARK(KeySwitchInnerProduct)->Unit(benchmark::kMicrosecond)->Apply(KSConfigs);
+BENCHMARK(KeySwitchModDown)->Unit(benchmark::kMicrosecond)->Apply(KSConfigs);
+BENCHMARK(KeySwitchFull)->Unit(benchmark::kMicrosecond)->Apply(KSConfigs);
+BENCHMARK(RotateNonHoisted)->Unit(benchmark::kMillisecond)->Apply(RotationConfigs);
+BENCHMARK(RotateHoisted)->Unit(benchmark::kMillisecond)->Apply(RotationConfigs);
+
+BENCHMARK_MAIN();
@@ -36,6 +36,7 @@
 #include "lwe-pke.h"
 #include "rgsw-acc.h"
 #include "rgsw-acc-cggi.h"
+#include "rgsw-acc-cggi-fft.h"
 #include "rgsw-acc-dm.h"
 #include "rgsw-acc-lmkcdey.h"
 #include "rgsw-acckey.h"
@@ -72,6 +73,8 @@ public:
             ACCscheme = std::make_shared<RingGSWAccumulatorCGGI>();
         else if (method == LMKCDEY)
             ACCscheme = std::make_shared<RingGSWAccumulatorLMKCDEY>();
+        else if (method == GINX_FFT)
+            ACCscheme = std::make_shared<RingGSWAccumulatorCGGIFFT>();
         else
             OPENFHE_THROW("method is invalid");
     }
@@ -148,6 +151,22 @@ public:
                            ConstLWECiphertext& ct, const std::vector<NativeInteger>& LUT,
                            NativeInteger beta) const;
 
+    /**
+   * Evaluate several arbitrary functions of the same input using multi-value bootstrapping: every
+   * blind rotation is shared by all functions
+   *
+   * @param params a shared pointer to RingGSW scheme parameters
+   * @param EK a shared pointer to the bootstrapping keys
+   * @param ct input ciphertext
+   * @param LUTs the look-up tables of the to-be-evaluated functions
+   * @param beta the error bound
+   * @return a vector of shared pointers to the resulting ciphertexts, one per look-up table
+   */
+    std::vector<LWECiphertext> EvalMultiFunc(const std::shared_ptr<BinFHECryptoParams>& params, const RingGSWBTKey& EK,
+                                             ConstLWECiphertext& ct,
+                                             const std::vector<std::vector<NativeInteger>>& LUTs,
+                                             NativeInteger beta) const;
+
     /**
    * Evaluate a round down function
    *
@@ -161,6 +180,20 @@ public:
     LWECiphertext EvalFloor(const std::shared_ptr<BinFHECryptoParams>& params, const RingGSWBTKey& EK,
                             ConstLWECiphertext& ct, NativeInteger beta, uint32_t roundbits = 0) const;
 
+    /**
+   * Evaluate a round down function over a batch of ciphertexts in parallel
+   *
+   * @param params a shared pointer to RingGSW scheme parameters
+   * @param EK a shared pointer to the bootstrapping keys
+   * @param cts input ciphertexts
+   * @param beta the error bound
+   * @param roundbits by how many bits to round down
+   * @return a vector of shared pointers to the resulting ciphertexts
+   */
+    std::vector<LWECiphertext> EvalFloor(const std::shared_ptr<BinFHECryptoParams>& params, const RingGSWBTKey& EK,
+                                         const std::vector<LWECiphertext>& cts, NativeInteger beta,
+                                         uint32_t roundbits = 0) const;
+
     /**
    * Evaluate a sign function over large precision
    *
@@ -175,6 +208,22 @@ public:
                            const std::map<uint32_t, RingGSWBTKey>& EKs, ConstLWECiphertext& ct,
                            NativeInteger beta, bool schemeSwitch = false) const;
 
+    /**
+   * Evaluate a sign function over large precision for a batch of ciphertexts with the same modulus;
+   * every bootstrapping stage runs in parallel over the batch
+   *
+   * @param params a shared pointer to RingGSW scheme parameters
+   * @param EK a shared pointer to the bootstrapping keys map
+   * @param cts input ciphertexts
+   * @param beta the error bound
+   * @param schemeSwitch flag that indicates if it should be compatible to scheme switching
+   * @return a vector of shared pointers to the resulting ciphertexts
+   */
+    std::vector<LWECiphertext> EvalSign(const std::shared_ptr<BinFHECryptoParams>& params,
+                                        const std::map<uint32_t, RingGSWBTKey>& EKs,
+                                        const std::vector<LWECiphertext>& cts, NativeInteger beta,
+                                        bool schemeSwitch = false) const;
+
     /**
    * Evaluate digit decomposition over a large precision LWE ciphertext
    *
@@ -188,6 +237,21 @@ public:
                                           const std::map<uint32_t, RingGSWBTKey>& EKs, ConstLWECiphertext& ct,
                                           NativeInteger beta) const;
 
+    /**
+   * Evaluate digit decomposition over a batch of large precision LWE ciphertexts with the same modulus;
+   * every bootstrapping stage runs in parallel over the batch
+   *
+   * @param params a shared pointer to RingGSW scheme parameters
+   * @param EKs a shared pointer to the bootstrapping keys map
+   * @param cts input ciphertexts
+   * @param beta the error bound
+   * @return the decomposition of every input ciphertext
+   */
+    std::vector<std::vector<LWECiphertext>> EvalDecomp(const std::shared_ptr<BinFHECryptoParams>& params,
+                                                       const std::map<uint32_t, RingGSWBTKey>& EKs,
+                                                       const std::vector<LWECiphertext>& cts,
+                                                       NativeInteger beta) const;
+
 private:
     /**
    * Core bootstrapping operation
@@ -231,6 +295,35 @@ private:
     LWECiphertext BootstrapFunc(const std::shared_ptr<BinFHECryptoParams>& params, const RingGSWBTKey& EK,
                                 ConstLWECiphertext& ct, const Func f, NativeInteger fmod) const;
 
+    /**
+   * Multi-value bootstrapping as described in https://eprint.iacr.org/2018/622: one blind rotation
+   * evaluates numFunc functions
+   *
+   * @param params a shared pointer to RingGSW scheme parameters
+   * @param EK a shared pointer to the bootstrapping keys
+   * @param ct input ciphertext
+   * @param f functions to evaluate; f(i, x, q, fmod) is the value of the i-th function
+   * @param numFunc number of functions
+   * @param fmod modulus over which the functions are defined
+   * @return a vector of shared pointers to the resulting ciphertexts
+   */
+    template <typename Func>
+    std::vector<LWECiphertext> BootstrapMultiFunc(const std::shared_ptr<BinFHECryptoParams>& params,
+                                                  const RingGSWBTKey& EK, ConstLWECiphertext& ct, const Func f,
+                                                  uint32_t numFunc, NativeInteger fmod) const;
+
+    /**
+   * Extracts an LWE ciphertext from the accumulator and switches it to the original key and modulus fmod
+   *
+   * @param params a shared pointer to RingGSW scheme parameters
+   * @param EK a shared pointer to the bootstrapping keys
+   * @param accVec elements of the accumulator in EVALUATION format; overwritten
+   * @param fmod modulus of the resulting ciphertext
+   * @return a shared pointer to the resulting ciphertext
+   */
+    LWECiphertext ExtractFunc(const std::shared_ptr<BinFHECryptoParams>& params, const RingGSWBTKey& EK,
+                              std::vector<NativePoly>& accVec, NativeInteger fmod) const;
+
 protected:
     std::shared_ptr<LWEEncryptionScheme> LWEscheme{std::make_shared<LWEEncryptionScheme>()};
     std::shared_ptr<RingGSWAccumulator> ACCscheme{nullptr};
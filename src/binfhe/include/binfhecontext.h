@@ -102,7 +102,7 @@ public:
    * @param baseG the gadget base used in bootstrapping
    * @param baseR the base used for refreshing
    * @param keyDist secret key distribution
-   * @param method the bootstrapping method (DM or CGGI or LMKCDEY)
+   * @param method the bootstrapping method (DM or CGGI or LMKCDEY or CGGI_FFT)
    * @param numAutoKeys number of automorphism keys in LMKCDEY bootstrapping
    * @return creates the cryptocontext
    */
@@ -119,7 +119,7 @@ public:
    * @param arbFunc whether need to evaluate an arbitrary function using functional bootstrapping
    * @param logQ log(input ciphertext modulus)
    * @param N ring dimension for RingGSW/RLWE used in bootstrapping
-   * @param method the bootstrapping method (DM or CGGI or LMKCDEY)
+   * @param method the bootstrapping method (DM or CGGI or LMKCDEY or CGGI_FFT)
    * @param timeOptimization whether to use dynamic bootstrapping technique
    * @return creates the cryptocontext
    */
@@ -131,7 +131,7 @@ public:
    * most users.
    *
    * @param set the parameter set: TOY, MEDIUM, STD128, STD192, STD256 with variants, see binfhe_constants.h
-   * @param method the bootstrapping method (DM or CGGI or LMKCDEY)
+   * @param method the bootstrapping method (DM or CGGI or LMKCDEY or CGGI_FFT)
    * @return create the cryptocontext
    */
     void GenerateBinFHEContext(BINFHE_PARAMSET set, BINFHE_METHOD method = GINX);
@@ -140,7 +140,7 @@ public:
    * Creates a crypto context using custom parameters.
    *
    * @param params the parameter context
-   * @param method the bootstrapping method (DM or CGGI or LMKCDEY)
+   * @param method the bootstrapping method (DM or CGGI or LMKCDEY or CGGI_FFT)
    * @return create the cryptocontext
    */
     void GenerateBinFHEContext(const BinFHEContextParams& params, BINFHE_METHOD method = GINX);
@@ -338,6 +338,17 @@ public:
    */
     LWECiphertext EvalFunc(ConstLWECiphertext& ct, const std::vector<NativeInteger>& LUT) const;
 
+    /**
+   * Evaluate several arbitrary functions of the same ciphertext; the blind rotations are shared by all
+   * functions (multi-value bootstrapping), so k functions cost as much as one
+   *
+   * @param ct ciphertext to be bootstrapped
+   * @param LUTs the look-up tables of the to-be-evaluated functions
+   * @return a vector of shared pointers to the resulting ciphertexts, one per look-up table
+   */
+    std::vector<LWECiphertext> EvalMultiFunc(ConstLWECiphertext& ct,
+                                             const std::vector<std::vector<NativeInteger>>& LUTs) const;
+
     /**
    * Generate the LUT for the to-be-evaluated function
    *
@@ -357,6 +368,15 @@ public:
    */
     LWECiphertext EvalFloor(ConstLWECiphertext& ct, uint32_t roundbits = 0) const;
 
+    /**
+   * Evaluate a round down function over a batch of ciphertexts in parallel
+   *
+   * @param cts ciphertexts to be bootstrapped
+   * @param roundbits number of bits to be rounded
+   * @return a vector of shared pointers to the resulting ciphertexts
+   */
+    std::vector<LWECiphertext> EvalFloor(const std::vector<LWECiphertext>& cts, uint32_t roundbits = 0) const;
+
     /**
    * Evaluate a sign function over large precisions
    *
@@ -366,6 +386,16 @@ public:
    */
     LWECiphertext EvalSign(ConstLWECiphertext& ct, bool schemeSwitch = false);
 
+    /**
+   * Evaluate a sign function over large precisions for a batch of ciphertexts with the same modulus;
+   * every bootstrapping stage runs in parallel over the batch
+   *
+   * @param cts ciphertexts to be bootstrapped
+   * @param schemeSwitch flag that indicates if it should be compatible to scheme switching
+   * @return a vector of shared pointers to the resulting ciphertexts
+   */
+    std::vector<LWECiphertext> EvalSign(const std::vector<LWECiphertext>& cts, bool schemeSwitch = false);
+
     /**
    * Evaluate ciphertext decomposition
    *
@@ -374,6 +404,15 @@ public:
    */
     std::vector<LWECiphertext> EvalDecomp(ConstLWECiphertext& ct);
 
+    /**
+   * Evaluate ciphertext decomposition for a batch of ciphertexts with the same modulus;
+   * every bootstrapping stage runs in parallel over the batch
+   *
+   * @param cts ciphertexts to be bootstrapped
+   * @return the decomposition of every input ciphertext
+   */
+    std::vector<std::vector<LWECiphertext>> EvalDecomp(const std::vector<LWECiphertext>& cts);
+
     /**
    * Evaluates NOT gate
    *
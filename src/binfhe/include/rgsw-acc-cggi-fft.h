@@ -0,0 +1,114 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+#ifndef _RGSW_ACC_CGGI_FFT_H_
+#define _RGSW_ACC_CGGI_FFT_H_
+
+#include "rgsw-acc.h"
+#include "rgsw-fft.h"
+
+#include <memory>
+#include <vector>
+
+namespace lbcrypto {
+
+/**
+ * @brief CGGI accumulator (https://eprint.iacr.org/2020/086) with the external product computed in a
+ * double-precision negacyclic FFT domain, as done in TFHE (https://eprint.iacr.org/2018/421.pdf).
+ * The refreshing key is kept in FFT form, the accumulator stays in COEFFICIENT format between the
+ * updates, and the monomials X^a - 1 are applied pointwise in the FFT domain.
+ */
+class RingGSWAccumulatorCGGIFFT final : public RingGSWAccumulator {
+public:
+    RingGSWAccumulatorCGGIFFT() = default;
+
+    /**
+   * Key generation for internal Ring GSW; the CGGI keys are stored in COEFFICIENT format together
+   * with their FFT form
+   *
+   * @param params a shared pointer to RingGSW scheme parameters
+   * @param skNTT secret key polynomial in the EVALUATION representation
+   * @param LWEsk the secret key
+   * @return a shared pointer to the resulting keys
+   */
+    RingGSWACCKey KeyGenAcc(const std::shared_ptr<RingGSWCryptoParams>& params, const NativePoly& skNTT,
+                            ConstLWEPrivateKey& LWEsk) const override;
+
+    /**
+   * Main accumulator function used in bootstrapping - GINX variant with the FFT external product
+   *
+   * @param params a shared pointer to RingGSW scheme parameters
+   * @param ek the accumulator key
+   * @param acc previous value of the accumulator
+   * @param a value to update the accumulator with
+   */
+    void EvalAcc(const std::shared_ptr<RingGSWCryptoParams>& params, ConstRingGSWACCKey& ek, RLWECiphertext& acc,
+                 const NativeVector& a) const override;
+
+private:
+    // Buffers reused across the accumulator updates
+    struct FFTScratch {
+        explicit FFTScratch(const std::shared_ptr<RingGSWCryptoParams>& params)
+            : dct(((params->GetDigitsG() - 1) << 1), NativePoly(params->GetPolyParams(), Format::COEFFICIENT, true)),
+              dctFFT(dct.size(), NegacyclicFFT::Spectrum(params->GetN() >> 1)),
+              sum(4, NegacyclicFFT::Spectrum(params->GetN() >> 1)) {}
+
+        std::vector<NativePoly> dct;
+        std::vector<NegacyclicFFT::Spectrum> dctFFT;
+        std::vector<NegacyclicFFT::Spectrum> sum;
+    };
+
+    /**
+   * Checks that the rounding error of the FFT external product accumulated over n updates stays
+   * below the error introduced by the modulus switching from Q to q
+   *
+   * @param params a shared pointer to RingGSW scheme parameters
+   * @param n number of accumulator updates
+   */
+    void CheckPrecision(const std::shared_ptr<RingGSWCryptoParams>& params, uint32_t n) const;
+
+    /**
+   * CGGI accumulation with the ternary MUX of https://eprint.iacr.org/2022/074.pdf section 5;
+   * acc and the decomposition are in COEFFICIENT format
+   *
+   * @param params a shared pointer to RingGSW scheme parameters
+   * @param ek1, ek2 evaluation keys for Ring GSW in FFT form
+   * @param a a value to add to the accumulator
+   * @param acc previous value of the accumulator
+   * @param scratch buffers reused across the accumulator updates
+   */
+    void AddToAccCGGIFFT(const std::shared_ptr<RingGSWCryptoParams>& params, ConstRingGSWEvalKey& ek1,
+                         ConstRingGSWEvalKey& ek2, uint32_t a, RLWECiphertext& acc, FFTScratch& scratch) const;
+};
+
+}  // namespace lbcrypto
+
+#endif  // _RGSW_ACC_CGGI_FFT_H_
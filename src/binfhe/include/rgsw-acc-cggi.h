@@ -88,9 +88,10 @@ private:
    * @param ek1, ek2 evaluation keys for Ring GSW
    * @param a a value to add to the accumulator
    * @param acc previous value of the accumulator
+   * @param scratch buffers reused across the accumulator updates
    */
     void AddToAccCGGI(const std::shared_ptr<RingGSWCryptoParams>& params, ConstRingGSWEvalKey& ek1,
-                      ConstRingGSWEvalKey& ek2, NativeInteger a, RLWECiphertext& acc) const;
+                      ConstRingGSWEvalKey& ek2, NativeInteger a, RLWECiphertext& acc, RingGSWAccScratch& scratch) const;
 };
 
 }  // namespace lbcrypto
@@ -86,10 +86,11 @@ private:
    * @param params a shared pointer to RingGSW scheme parameters
    * @param ek evaluation key for Ring GSW
    * @param acc previous value of the accumulator
+   * @param scratch buffers reused across the accumulator updates
    * @return
    */
-    void AddToAccDM(const std::shared_ptr<RingGSWCryptoParams>& params, ConstRingGSWEvalKey& ek,
-                    RLWECiphertext& acc) const;
+    void AddToAccDM(const std::shared_ptr<RingGSWCryptoParams>& params, ConstRingGSWEvalKey& ek, RLWECiphertext& acc,
+                    RingGSWAccScratch& scratch) const;
 };
 
 }  // namespace lbcrypto
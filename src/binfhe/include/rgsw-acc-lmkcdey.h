@@ -35,6 +35,7 @@
 #include "rgsw-acc.h"
 
 #include <memory>
+#include <vector>
 
 namespace lbcrypto {
 
@@ -97,22 +98,24 @@ private:
    * @param params a shared pointer to RingGSW scheme parameters
    * @param ek evaluation key for Ring GSW
    * @param acc previous value of the accumulator
+   * @param scratch buffers reused across the accumulator updates
    * @return
    */
     void AddToAccLMKCDEY(const std::shared_ptr<RingGSWCryptoParams>& params, ConstRingGSWEvalKey& ek,
-                         RLWECiphertext& acc) const;
+                         RLWECiphertext& acc, RingGSWAccScratch& scratch) const;
 
     /**
    * LMKCDEY Accumulation automorphism evaluation as described in https://eprint.iacr.org/2022/198
    *
    * @param params a shared pointer to RingGSW scheme parameters
-   * @param a index
+   * @param autoMap precomputed index map of the automorphism (see RingGSWCryptoParams::GetAutoMap)
    * @param ak evaluation key for Ring GSW
    * @param acc previous value of the accumulator
+   * @param scratch buffers reused across the accumulator updates
    * @return
    */
-    void Automorphism(const std::shared_ptr<RingGSWCryptoParams>& params, NativeInteger a,
-                      ConstRingGSWEvalKey& ak, RLWECiphertext& acc) const;
+    void Automorphism(const std::shared_ptr<RingGSWCryptoParams>& params, const std::vector<uint32_t>& autoMap,
+                      ConstRingGSWEvalKey& ak, RLWECiphertext& acc, RingGSWAccScratch& scratch) const;
 };
 
 }  // namespace lbcrypto
@@ -41,6 +41,24 @@
 
 namespace lbcrypto {
 
+/**
+ * @brief Buffers reused by every accumulator update of one blind rotation. EvalAcc creates one set per
+ * call (i.e., per bootstrapping and per thread), so the n updates of a bootstrapping do not allocate.
+ */
+struct RingGSWAccScratch {
+    explicit RingGSWAccScratch(const std::shared_ptr<RingGSWCryptoParams>& params)
+        : ct(2, NativePoly(params->GetPolyParams(), Format::COEFFICIENT, true)),
+          dct(((params->GetDigitsG() - 1) << 1), NativePoly(params->GetPolyParams(), Format::COEFFICIENT, true)),
+          sum(2, NativePoly(params->GetPolyParams(), Format::EVALUATION, true)) {}
+
+    // copy of the accumulator (or of its automorphism) being decomposed
+    std::vector<NativePoly> ct;
+    // signed digit decomposition of ct
+    std::vector<NativePoly> dct;
+    // external product output when it is not written into the accumulator directly
+    std::vector<NativePoly> sum;
+};
+
 /**
  * @brief Ring GSW accumulator schemes described in
  * https://eprint.iacr.org/2014/816, https://eprint.iacr.org/2020/086 and https://eprint.iacr.org/2022/198
@@ -97,6 +115,19 @@ public:
    */
     void SignedDigitDecompose(const std::shared_ptr<RingGSWCryptoParams>& params, const NativePoly& input,
                               std::vector<NativePoly>& output) const;
+
+    /**
+   * Fused external product of decomposed digits with a RingGSW ciphertext: out[j] = sum_d dct[d] * ev[d][j],
+   * j = 0, 1. The products are accumulated in place with Montgomery reductions, so no temporary polynomials
+   * are created
+   *
+   * @param dct digits in the EVALUATION representation
+   * @param ev elements of the RingGSW ciphertext in the EVALUATION representation
+   * @param digits number of digits to use
+   * @param out two allocated polynomials that are overwritten with the result
+   */
+    void ExternalProduct(const std::vector<NativePoly>& dct, const std::vector<std::vector<NativePoly>>& ev,
+                         uint32_t digits, std::vector<NativePoly>& out) const;
 };
 
 }  // namespace lbcrypto
@@ -39,6 +39,7 @@
 #include "lwe-keyswitchkey.h"
 #include "math/discretegaussiangenerator.h"
 #include "math/nbtheory.h"
+#include "rgsw-fft.h"
 #include "utils/serializable.h"
 #include "utils/utilities.h"
 
@@ -66,7 +67,7 @@ public:
    * @param q ciphertext modulus for additive LWE
    * @param baseG the gadget base used in the bootstrapping
    * @param baseR the base for the refreshing key
-   * @param method bootstrapping method (DM or CGGI or LMKCDEY)
+   * @param method bootstrapping method (DM or CGGI or LMKCDEY or CGGI_FFT)
    * @param std standar deviation
    * @param keyDist secret key distribution
    * @param signEval flag if sign evaluation is needed
@@ -143,6 +144,10 @@ public:
         return m_logGen;
     }
 
+    const std::vector<uint32_t>& GetAutoMap(uint32_t i) const {
+        return m_autoMaps[i];
+    }
+
     const std::map<uint32_t, std::vector<NativeInteger>>& GetGPowerMap() const {
         return m_Gpower_map;
     }
@@ -159,6 +164,10 @@ public:
         return m_monomials[i];
     }
 
+    const std::shared_ptr<NegacyclicFFT>& GetFFT() const {
+        return m_fft;
+    }
+
     BINFHE_METHOD GetMethod() const {
         return m_method;
     }
@@ -261,6 +270,11 @@ private:
     // m_logGen[-1 (mod M)] = M (special case for efficiency)
     std::vector<int32_t> m_logGen;
 
+    // Index maps of the automorphisms applied in the accumulator (only for LMKCDEY)
+    // m_autoMaps[i] is the map for X -> X^{5^i} (1 <= i <= m_numAutoKeys)
+    // m_autoMaps[0] is the map for X -> X^{-5}
+    std::vector<std::vector<uint32_t>> m_autoMaps;
+
     // Error distribution generator
     DiscreteGaussianGeneratorImpl<NativeVector> m_dgg;
 
@@ -277,6 +291,9 @@ private:
     // (used only for CGGI bootstrapping)
     std::vector<NativePoly> m_monomials;
 
+    // Tables of the double-precision negacyclic FFT (used only for GINX_FFT bootstrapping)
+    std::shared_ptr<NegacyclicFFT> m_fft;
+
     // Bootstrapping method (DM or CGGI or LMKCDEY)
     BINFHE_METHOD m_method{BINFHE_METHOD::INVALID_METHOD};
 
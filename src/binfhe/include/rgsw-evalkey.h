@@ -37,6 +37,7 @@
 #include "lwe-cryptoparameters.h"
 #include "lwe-keyswitchkey.h"
 #include "lwe-privatekey.h"
+#include "rgsw-fft.h"
 #include "math/discretegaussiangenerator.h"
 #include "math/nbtheory.h"
 #include "utils/serializable.h"
@@ -67,17 +68,21 @@ public:
 
     explicit RingGSWEvalKeyImpl(const std::vector<std::vector<NativePoly>>& elements) : m_elements(elements) {}
 
-    RingGSWEvalKeyImpl(const RingGSWEvalKeyImpl& rhs) : m_elements(rhs.m_elements) {}
+    RingGSWEvalKeyImpl(const RingGSWEvalKeyImpl& rhs)
+        : m_elements(rhs.m_elements), m_elementsFFT(rhs.m_elementsFFT) {}
 
-    RingGSWEvalKeyImpl(RingGSWEvalKeyImpl&& rhs) noexcept : m_elements(std::move(rhs.m_elements)) {}
+    RingGSWEvalKeyImpl(RingGSWEvalKeyImpl&& rhs) noexcept
+        : m_elements(std::move(rhs.m_elements)), m_elementsFFT(std::move(rhs.m_elementsFFT)) {}
 
     RingGSWEvalKeyImpl& operator=(const RingGSWEvalKeyImpl& rhs) {
-        RingGSWEvalKeyImpl::m_elements = rhs.m_elements;
+        RingGSWEvalKeyImpl::m_elements    = rhs.m_elements;
+        RingGSWEvalKeyImpl::m_elementsFFT = rhs.m_elementsFFT;
         return *this;
     }
 
     RingGSWEvalKeyImpl& operator=(RingGSWEvalKeyImpl&& rhs) noexcept {
-        RingGSWEvalKeyImpl::m_elements = std::move(rhs.m_elements);
+        RingGSWEvalKeyImpl::m_elements    = std::move(rhs.m_elements);
+        RingGSWEvalKeyImpl::m_elementsFFT = std::move(rhs.m_elementsFFT);
         return *this;
     }
 
@@ -93,6 +98,20 @@ public:
         m_elements = std::move(elements);
     }
 
+    /**
+   * Returns the FFT form of the elements; only populated for keys of the FFT accumulator (GINX_FFT)
+   */
+    const std::vector<std::vector<NegacyclicFFT::Spectrum>>& GetElementsFFT() const {
+        return m_elementsFFT;
+    }
+
+    /**
+   * Computes the FFT form of the elements, which must be in COEFFICIENT format
+   *
+   * @param fft transform tables for the ring dimension of the elements
+   */
+    void ComputeElementsFFT(const NegacyclicFFT& fft);
+
     /**
    * Switches between COEFFICIENT and Format::EVALUATION polynomial
    * representations using NTT
@@ -145,6 +164,11 @@ public:
                           " is from a later version of the library");
         }
         ar(::cereal::make_nvp("elements", m_elements));
+
+        // keys of the FFT accumulator are the only ones kept in COEFFICIENT format;
+        // their FFT form is not serialized and is rebuilt here
+        if (!m_elements.empty() && !m_elements[0].empty() && m_elements[0][0].GetFormat() == Format::COEFFICIENT)
+            ComputeElementsFFT(NegacyclicFFT(m_elements[0][0].GetRingDimension()));
     }
 
     std::string SerializedObjectName() const override {
@@ -157,6 +181,9 @@ public:
 
 private:
     std::vector<std::vector<NativePoly>> m_elements;
+
+    // FFT form of m_elements (only for GINX_FFT)
+    std::vector<std::vector<NegacyclicFFT::Spectrum>> m_elementsFFT;
 };
 
 }  // namespace lbcrypto
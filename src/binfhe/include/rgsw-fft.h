@@ -0,0 +1,109 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+#ifndef _RGSW_FFT_H_
+#define _RGSW_FFT_H_
+
+#include "lattice/lat-hal.h"
+
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+namespace lbcrypto {
+
+/**
+ * @brief Double-precision negacyclic FFT over Z[X]/(X^N + 1) used by the FFT accumulator (GINX_FFT).
+ *
+ * A real polynomial a(X) of degree < N is evaluated at the N/2 roots x_k = zeta^(1+4k) of X^N + 1,
+ * zeta = exp(i*pi/N), that satisfy x^(N/2) = i; the remaining roots are their conjugates and carry no
+ * extra information. With c_j = (a_j + i*a_(j+N/2)) * zeta^j this is a complex DFT of size N/2.
+ * The spectrum is kept in bit-reversed order: position p holds a(x_k) for k = bitreverse(p).
+ */
+class NegacyclicFFT {
+public:
+    using Spectrum = std::vector<std::complex<double>>;
+
+    explicit NegacyclicFFT(uint32_t N);
+
+    uint32_t GetRingDimension() const {
+        return m_N;
+    }
+
+    /**
+   * Computes the spectrum of a polynomial in COEFFICIENT format; coefficients are read as centered
+   * residues in (-Q/2, Q/2]
+   *
+   * @param a input polynomial
+   * @param out output spectrum of size N/2
+   */
+    void Forward(const NativePoly& a, Spectrum& out) const;
+
+    /**
+   * Transforms a spectrum back, rounds every coefficient to the nearest integer and adds it modulo Q
+   * to a polynomial in COEFFICIENT format
+   *
+   * @param in input spectrum of size N/2; overwritten
+   * @param a polynomial the result is added to
+   */
+    void InverseAdd(Spectrum& in, NativePoly& a) const;
+
+    /**
+   * Returns the evaluation of X^m at the root stored in position p of the spectrum
+   */
+    const std::complex<double>& MonomialAt(uint32_t m, uint32_t p) const {
+        return m_zetaPow[(m * m_rootExp[p]) & (2 * m_N - 1)];
+    }
+
+private:
+    void TransformInPlace(Spectrum& a) const;
+    void InverseTransformInPlace(Spectrum& a) const;
+
+    // ring dimension
+    uint32_t m_N;
+
+    // zeta^m for m in [0, 2N)
+    Spectrum m_zetaPow;
+
+    // exponent 1+4k of the root held in position p of the spectrum
+    std::vector<uint32_t> m_rootExp;
+
+    // exp(2*pi*i*t/(N/2)) for t in [0, N/4)
+    Spectrum m_twiddles;
+
+    // zeta^j for j in [0, N/2) and zeta^(-j)/(N/2), applied before and after the transforms
+    Spectrum m_twist;
+    Spectrum m_untwist;
+};
+
+}  // namespace lbcrypto
+
+#endif  // _RGSW_FFT_H_
@@ -30,9 +30,11 @@
 //==================================================================================
 
 #include "binfhe-base-scheme.h"
+#include "utils/profiler.h"
 
 #include <map>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -331,6 +333,100 @@ LWECiphertext BinFHEScheme::EvalFunc(const std::shared_ptr<BinFHECryptoParams>&
     return BootstrapFunc(params, EK, ct2, fLUT1, q);
 }
 
+// Evaluate several arbitrary functions of the same input
+// The preliminary bootstrap of the periodic and arbitrary cases depends only on the input, so every stage
+// needs one blind rotation regardless of the number of functions
+std::vector<LWECiphertext> BinFHEScheme::EvalMultiFunc(const std::shared_ptr<BinFHECryptoParams>& params,
+                                                       const RingGSWBTKey& EK, ConstLWECiphertext& ct,
+                                                       const std::vector<std::vector<NativeInteger>>& LUTs,
+                                                       NativeInteger beta) const {
+    if (params == nullptr)
+        OPENFHE_THROW("BinFHECryptoParams is empty");
+    if (ct == nullptr)
+        OPENFHE_THROW("Ciphertext is empty");
+    if (LUTs.empty())
+        OPENFHE_THROW("No look-up tables to evaluate");
+
+    auto ct1 = std::make_shared<LWECiphertextImpl>(*ct);
+    NativeInteger q{ct->GetModulus()};
+    uint32_t numFunc = LUTs.size();
+    for (const auto& LUT : LUTs) {
+        if (LUT.size() != q.ConvertToInt())
+            OPENFHE_THROW("The size of every look-up table should be equal to the ciphertext modulus");
+    }
+
+    // functions of different types are all evaluated as arbitrary functions
+    uint32_t functionProperty{this->checkInputFunction(LUTs[0], q)};
+    for (uint32_t i = 1; i < numFunc; ++i) {
+        if (this->checkInputFunction(LUTs[i], q) != functionProperty)
+            functionProperty = 2;
+    }
+
+    if (functionProperty == 0) {  // negacyclic functions only need one bootstrap
+        auto fLUT = [&LUTs](uint32_t i, NativeInteger x, NativeInteger q, NativeInteger Q) -> NativeInteger {
+            return LUTs[i][x.ConvertToInt()];
+        };
+        LWEscheme->EvalAddConstEq(ct1, beta);
+        return BootstrapMultiFunc(params, EK, ct1, fLUT, numFunc, q);
+    }
+
+    // this is 1/4q_small or -1/4q_small mod q
+    auto f0 = [](NativeInteger x, NativeInteger q, NativeInteger Q) -> NativeInteger {
+        if (x < (q >> 1))
+            return Q - (q >> 2);
+        else
+            return (q >> 2);
+    };
+
+    if (functionProperty == 2) {  // arbitary functions
+        const auto& LWEParams = params->GetLWEParams();
+        uint32_t N{LWEParams->GetN()};
+        if (q.ConvertToInt() > N)
+            OPENFHE_THROW("Ciphertext modulus q must be <= ring dimension for arbitrary function evaluation");
+
+        NativeInteger dq{q << 1};
+        // raise the modulus of ct1 : q -> 2q
+        ct1->GetA().SetModulus(dq);
+        auto ct2 = std::make_shared<LWECiphertextImpl>(*ct1);
+        LWEscheme->EvalAddConstEq(ct2, beta);
+
+        auto ct3 = BootstrapFunc(params, EK, ct2, f0, dq);
+        LWEscheme->EvalSubEq2(ct1, ct3);
+        LWEscheme->EvalAddConstEq(ct3, beta);
+        LWEscheme->EvalSubConstEq(ct3, q >> 1);
+
+        // Now the input is within the range [0, q/2).
+        // Note that for non-periodic function, the input q is boosted up to 2q;
+        // the tables are repeated to make them periodic
+        auto fLUT2 = [&LUTs, q](uint32_t i, NativeInteger x, NativeInteger dq, NativeInteger Q) -> NativeInteger {
+            if (x < (dq >> 1))
+                return LUTs[i][x.Mod(q).ConvertToInt()];
+            else
+                return Q - LUTs[i][(x - (dq >> 1)).Mod(q).ConvertToInt()];
+        };
+        auto result = BootstrapMultiFunc(params, EK, ct3, fLUT2, numFunc, dq);
+        for (auto& ct4 : result)
+            ct4->SetModulus(q);
+        return result;
+    }
+
+    // Else they are periodic functions so we evaluate directly
+    LWEscheme->EvalAddConstEq(ct1, beta);
+    auto ct2 = BootstrapFunc(params, EK, ct1, f0, q);
+    LWEscheme->EvalSubEq2(ct, ct2);
+    LWEscheme->EvalAddConstEq(ct2, beta);
+    LWEscheme->EvalSubConstEq(ct2, q >> 2);
+
+    // Now the input is within the range [0, q/2).
+    auto fLUT1 = [&LUTs](uint32_t i, NativeInteger x, NativeInteger q, NativeInteger Q) -> NativeInteger {
+        if (x < (q >> 1))
+            return LUTs[i][x.ConvertToInt()];
+        else
+            return Q - LUTs[i][x.ConvertToInt() - q.ConvertToInt() / 2];
+    };
+    return BootstrapMultiFunc(params, EK, ct2, fLUT1, numFunc, q);
+}
+
 // Evaluate Homomorphic Flooring
 LWECiphertext BinFHEScheme::EvalFloor(const std::shared_ptr<BinFHECryptoParams>& params, const RingGSWBTKey& EK,
                                       ConstLWECiphertext& ct, NativeInteger beta, uint32_t roundbits) const {
@@ -376,16 +472,56 @@ LWECiphertext BinFHEScheme::EvalFloor(const std::shared_ptr<BinFHECryptoParams>&
     return ct1;
 }
 
+// Evaluate a round down function over a batch of ciphertexts
+std::vector<LWECiphertext> BinFHEScheme::EvalFloor(const std::shared_ptr<BinFHECryptoParams>& params,
+                                                   const RingGSWBTKey& EK, const std::vector<LWECiphertext>& cts,
+                                                   NativeInteger beta, uint32_t roundbits) const {
+    if (params == nullptr)
+        OPENFHE_THROW("BinFHECryptoParams is empty");
+    for (const auto& ct : cts) {
+        if (ct == nullptr)
+            OPENFHE_THROW("Ciphertext is empty");
+    }
+
+    uint32_t numCt = cts.size();
+    std::vector<LWECiphertext> result(numCt);
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCt))
+    for (uint32_t i = 0; i < numCt; ++i)
+        result[i] = EvalFloor(params, EK, cts[i], beta, roundbits);
+    return result;
+}
+
 // Evaluate large-precision sign
 LWECiphertext BinFHEScheme::EvalSign(const std::shared_ptr<BinFHECryptoParams>& params,
                                      const std::map<uint32_t, RingGSWBTKey>& EKs, ConstLWECiphertext& ct,
                                      NativeInteger beta, bool schemeSwitch) const {
-    if (params == nullptr)
-        OPENFHE_THROW("BinFHECryptoParams is empty");
     if (ct == nullptr)
         OPENFHE_THROW("Ciphertext is empty");
+    std::vector<LWECiphertext> cts{std::make_shared<LWECiphertextImpl>(*ct)};
+    return EvalSign(params, EKs, cts, beta, schemeSwitch)[0];
+}
 
-    auto mod{ct->GetModulus()};
+// Evaluate large-precision sign over a batch of ciphertexts
+// All ciphertexts go through the same sequence of moduli and gadget bases, so every flooring stage runs in
+// parallel over the batch and the gadget base, which is shared by the parameters, only changes between stages
+std::vector<LWECiphertext> BinFHEScheme::EvalSign(const std::shared_ptr<BinFHECryptoParams>& params,
+                                                  const std::map<uint32_t, RingGSWBTKey>& EKs,
+                                                  const std::vector<LWECiphertext>& cts, NativeInteger beta,
+                                                  bool schemeSwitch) const {
+    if (params == nullptr)
+        OPENFHE_THROW("BinFHECryptoParams is empty");
+    if (cts.empty())
+        return {};
+    for (const auto& ct : cts) {
+        if (ct == nullptr)
+            OPENFHE_THROW("Ciphertext is empty");
+    }
+
+    auto mod{cts[0]->GetModulus()};
+    for (const auto& ct : cts) {
+        if (ct->GetModulus() != mod)
+            OPENFHE_THROW("All ciphertexts should have the same modulus");
+    }
     const auto& LWEParams = params->GetLWEParams();
     auto q{LWEParams->Getq()};
     if (mod <= q)
@@ -398,13 +534,17 @@ LWECiphertext BinFHEScheme::EvalSign(const std::shared_ptr<BinFHECryptoParams>&
         OPENFHE_THROW("No key [" + std::to_string(curBase) + "] found in the map");
     RingGSWBTKey curEK(search->second);
 
-    auto cttmp = std::make_shared<LWECiphertextImpl>(*ct);
+    uint32_t numCt = cts.size();
+    std::vector<LWECiphertext> cttmp(numCt);
+    for (uint32_t i = 0; i < numCt; ++i)
+        cttmp[i] = std::make_shared<LWECiphertextImpl>(*cts[i]);
     while (mod > q) {
-        cttmp = EvalFloor(params, curEK, cttmp, beta);
         // round Q to 2betaQ/q
         //  mod   = mod / q * 2 * beta;
-        mod   = (mod << 1) * beta / q;
-        cttmp = LWEscheme->ModSwitch(mod, cttmp);
+        mod = (mod << 1) * beta / q;
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCt))
+        for (uint32_t i = 0; i < numCt; ++i)
+            cttmp[i] = LWEscheme->ModSwitch(mod, EvalFloor(params, curEK, cttmp[i], beta));
 
         // if dynamic
         if (EKs.size() == 3) {
@@ -426,22 +566,26 @@ LWECiphertext BinFHEScheme::EvalSign(const std::shared_ptr<BinFHECryptoParams>&
             }
         }
     }
-    LWEscheme->EvalAddConstEq(cttmp, beta);
 
-    if (!schemeSwitch) {
-        // if the ended q is smaller than q, we need to change the param for the final boostrapping
-        auto f3 = [](NativeInteger x, NativeInteger q, NativeInteger Q) -> NativeInteger {
-            return (x < q / 2) ? (Q / 4) : (Q - Q / 4);
-        };
-        cttmp = BootstrapFunc(params, curEK, cttmp, f3, q);  // this is 1/4q_small or -1/4q_small mod q
-        LWEscheme->EvalSubConstEq(cttmp, q >> 2);
-    }
-    else {  // return the negated f3 and do not subtract q/4 for a more natural encoding in scheme switching
-        // if the ended q is smaller than q, we need to change the param for the final boostrapping
-        auto f3 = [](NativeInteger x, NativeInteger q, NativeInteger Q) -> NativeInteger {
-            return (x < q / 2) ? (Q - Q / 4) : (Q / 4);
-        };
-        cttmp = BootstrapFunc(params, curEK, cttmp, f3, q);  // this is 1/4q_small or -1/4q_small mod q
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCt))
+    for (uint32_t i = 0; i < numCt; ++i) {
+        LWEscheme->EvalAddConstEq(cttmp[i], beta);
+
+        if (!schemeSwitch) {
+            // if the ended q is smaller than q, we need to change the param for the final boostrapping
+            auto f3 = [](NativeInteger x, NativeInteger q, NativeInteger Q) -> NativeInteger {
+                return (x < q / 2) ? (Q / 4) : (Q - Q / 4);
+            };
+            cttmp[i] = BootstrapFunc(params, curEK, cttmp[i], f3, q);  // this is 1/4q_small or -1/4q_small mod q
+            LWEscheme->EvalSubConstEq(cttmp[i], q >> 2);
+        }
+        else {  // return the negated f3 and do not subtract q/4 for a more natural encoding in scheme switching
+            // if the ended q is smaller than q, we need to change the param for the final boostrapping
+            auto f3 = [](NativeInteger x, NativeInteger q, NativeInteger Q) -> NativeInteger {
+                return (x < q / 2) ? (Q - Q / 4) : (Q / 4);
+            };
+            cttmp[i] = BootstrapFunc(params, curEK, cttmp[i], f3, q);  // this is 1/4q_small or -1/4q_small mod q
+        }
     }
     RGSWParams->Change_BaseG(curBase);
     return cttmp;
@@ -451,14 +595,33 @@ LWECiphertext BinFHEScheme::EvalSign(const std::shared_ptr<BinFHECryptoParams>&
 std::vector<LWECiphertext> BinFHEScheme::EvalDecomp(const std::shared_ptr<BinFHECryptoParams>& params,
                                                     const std::map<uint32_t, RingGSWBTKey>& EKs, ConstLWECiphertext& ct,
                                                     NativeInteger beta) const {
-    if (params == nullptr)
-        OPENFHE_THROW("BinFHECryptoParams is empty");
     if (ct == nullptr)
         OPENFHE_THROW("Ciphertext is empty");
+    std::vector<LWECiphertext> cts{std::make_shared<LWECiphertextImpl>(*ct)};
+    return EvalDecomp(params, EKs, cts, beta)[0];
+}
+
+// Evaluate Ciphertext Decomposition over a batch of ciphertexts, stage by stage as in the batched sign evaluation
+std::vector<std::vector<LWECiphertext>> BinFHEScheme::EvalDecomp(const std::shared_ptr<BinFHECryptoParams>& params,
+                                                                 const std::map<uint32_t, RingGSWBTKey>& EKs,
+                                                                 const std::vector<LWECiphertext>& cts,
+                                                                 NativeInteger beta) const {
+    if (params == nullptr)
+        OPENFHE_THROW("BinFHECryptoParams is empty");
+    if (cts.empty())
+        return {};
+    for (const auto& ct : cts) {
+        if (ct == nullptr)
+            OPENFHE_THROW("Ciphertext is empty");
+    }
 
-    auto mod         = ct->GetModulus();
+    auto mod         = cts[0]->GetModulus();
     auto& LWEParams  = params->GetLWEParams();
     auto& RGSWParams = params->GetRingGSWParams();
+    for (const auto& ct : cts) {
+        if (ct->GetModulus() != mod)
+            OPENFHE_THROW("All ciphertexts should have the same modulus");
+    }
 
     NativeInteger q = LWEParams->Getq();
     if (mod <= q)
@@ -470,18 +633,24 @@ std::vector<LWECiphertext> BinFHEScheme::EvalDecomp(const std::shared_ptr<BinFHE
         OPENFHE_THROW("No key [" + std::to_string(curBase) + "] found in the map");
     RingGSWBTKey curEK(search->second);
 
-    auto cttmp = std::make_shared<LWECiphertextImpl>(*ct);
-    std::vector<LWECiphertext> ret;
+    uint32_t numCt = cts.size();
+    std::vector<LWECiphertext> cttmp(numCt);
+    for (uint32_t i = 0; i < numCt; ++i)
+        cttmp[i] = std::make_shared<LWECiphertextImpl>(*cts[i]);
+    std::vector<std::vector<LWECiphertext>> ret(numCt);
     while (mod > q) {
-        auto ctq = std::make_shared<LWECiphertextImpl>(*cttmp);
-        ctq->SetModulus(q);
-        ret.push_back(std::move(ctq));
+        for (uint32_t i = 0; i < numCt; ++i) {
+            auto ctq = std::make_shared<LWECiphertextImpl>(*cttmp[i]);
+            ctq->SetModulus(q);
+            ret[i].push_back(std::move(ctq));
+        }
 
         // Floor the input sequentially to obtain the most significant bit
-        cttmp = EvalFloor(params, curEK, cttmp, beta);
-        mod   = mod / q * 2 * beta;
+        mod = mod / q * 2 * beta;
         // round Q to 2betaQ/q
-        cttmp = LWEscheme->ModSwitch(mod, cttmp);
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCt))
+        for (uint32_t i = 0; i < numCt; ++i)
+            cttmp[i] = LWEscheme->ModSwitch(mod, EvalFloor(params, curEK, cttmp[i], beta));
 
         if (EKs.size() == 3) {  // if dynamic
             uint32_t binLog = static_cast<uint32_t>(std::ceil(std::log2(mod.ConvertToInt())));
@@ -502,7 +671,8 @@ std::vector<LWECiphertext> BinFHEScheme::EvalDecomp(const std::shared_ptr<BinFHE
         }
     }
     RGSWParams->Change_BaseG(curBase);
-    ret.push_back(std::move(cttmp));
+    for (uint32_t i = 0; i < numCt; ++i)
+        ret[i].push_back(std::move(cttmp[i]));
     return ret;
 }
 
@@ -517,6 +687,8 @@ RLWECiphertext BinFHEScheme::BootstrapGateCore(const std::shared_ptr<BinFHECrypt
     if (ek == nullptr)
         OPENFHE_THROW("Bootstrapping keys have not been generated. Please call BTKeyGen before calling bootstrapping.");
 
+    PerfScope perfScope(PerfOp::BINFHE_BOOTSTRAP);
+
     // Specifies the range [lb, ub) that will be used for mapping
     NativeInteger q  = ct->GetModulus();
     auto qHalf       = q.ConvertToInt<uint32_t>() >> 1;
@@ -578,6 +750,8 @@ RLWECiphertext BinFHEScheme::BootstrapFuncCore(const std::shared_ptr<BinFHECrypt
     if (ek == nullptr)
         OPENFHE_THROW("Bootstrapping keys not generated. Please call BTKeyGen before bootstrapping.");
 
+    PerfScope perfScope(PerfOp::BINFHE_BOOTSTRAP);
+
     auto& LWEParams  = params->GetLWEParams();
     auto& RGSWParams = params->GetRingGSWParams();
     auto polyParams  = RGSWParams->GetPolyParams();
@@ -612,9 +786,92 @@ RLWECiphertext BinFHEScheme::BootstrapFuncCore(const std::shared_ptr<BinFHECrypt
 template <typename Func>
 LWECiphertext BinFHEScheme::BootstrapFunc(const std::shared_ptr<BinFHECryptoParams>& params, const RingGSWBTKey& EK,
                                           ConstLWECiphertext& ct, const Func f, NativeInteger fmod) const {
+    auto accVec{BootstrapFuncCore(params, EK.BSkey, ct, f, fmod)->GetElements()};
+    return ExtractFunc(params, EK, accVec, fmod);
+}
+
+// Multi-value bootstrapping as described in https://eprint.iacr.org/2018/622
+// With Y = X^factor and N' = q/2, the test polynomial of every function factors as F_i(Y) = v0(Y) * w_i(Y), where
+// v0 = c (1 + Y + ... + Y^{N'-1}) and w_i = F_i(Y) (1 - Y) / (2c), because (1 + Y + ... + Y^{N'-1}) (1 - Y) = 2
+// modulo Y^{N'} + 1. Only v0 is blind-rotated. The coefficients of F_i (1 - Y) are divided by their common
+// divisor g and c = g * Q / (2 fmod), so that the w_i are small and the noise of the rotated v0 is multiplied by
+// the norm of w_i only.
+template <typename Func>
+std::vector<LWECiphertext> BinFHEScheme::BootstrapMultiFunc(const std::shared_ptr<BinFHECryptoParams>& params,
+                                                            const RingGSWBTKey& EK, ConstLWECiphertext& ct,
+                                                            const Func f, uint32_t numFunc, NativeInteger fmod) const {
+    if (EK.BSkey == nullptr)
+        OPENFHE_THROW("Bootstrapping keys not generated. Please call BTKeyGen before bootstrapping.");
+
+    PerfScope perfScope(PerfOp::BINFHE_BOOTSTRAP);
+
+    auto& LWEParams  = params->GetLWEParams();
+    auto& RGSWParams = params->GetRingGSWParams();
+    auto polyParams  = RGSWParams->GetPolyParams();
+
+    NativeInteger Q     = LWEParams->GetQ();
+    uint32_t N          = LWEParams->GetN();
+    NativeInteger ctMod = ct->GetModulus();
+    uint32_t factor     = (2 * N / ctMod.ConvertToInt());
+    uint32_t half       = ctMod.ConvertToInt<uint32_t>() >> 1;
+    NativeInteger b     = ct->GetB();
+
+    // coefficients of F_i (1 - Y), with the values of F_i centered modulo fmod
+    auto fmodInt{fmod.ConvertToInt<int64_t>()};
+    std::vector<std::vector<int64_t>> w(numFunc, std::vector<int64_t>(half));
+    std::vector<int64_t> F(half);
+    int64_t g{0};
+    for (uint32_t i = 0; i < numFunc; ++i) {
+        for (uint32_t j = 0; j < half; ++j) {
+            auto v{f(i, b.ModSub(j, ctMod), ctMod, fmod).template ConvertToInt<int64_t>()};
+            F[j] = v > (fmodInt >> 1) ? v - fmodInt : v;
+        }
+        w[i][0] = F[0] + F[half - 1];
+        for (uint32_t j = 1; j < half; ++j)
+            w[i][j] = F[j] - F[j - 1];
+        for (uint32_t j = 0; j < half; ++j)
+            g = std::gcd(g, w[i][j]);
+    }
+    if (g == 0)  // all functions are zero
+        g = 1;
+
+    NativeVector m(N, Q);
+    NativeInteger c{Q.ConvertToInt() / fmod.ConvertToInt() * static_cast<BasicInteger>(g) / 2};
+    for (uint32_t j = 0; j < half; ++j)
+        m[j * factor] = c;
+    std::vector<NativePoly> res(2);
+    // no need to do NTT as all coefficients of this poly are zero
+    res[0] = NativePoly(polyParams, Format::EVALUATION, true);
+    res[1] = NativePoly(polyParams, Format::COEFFICIENT, false);
+    res[1].SetValues(std::move(m), Format::COEFFICIENT);
+    res[1].SetFormat(Format::EVALUATION);
+
+    // main accumulation computation, shared by all functions
+    auto acc = std::make_shared<RLWECiphertextImpl>(std::move(res));
+    ACCscheme->EvalAcc(RGSWParams, EK.BSkey, acc, ct->GetA());
+    const auto& accElems = acc->GetElements();
+
+    std::vector<LWECiphertext> result(numFunc);
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numFunc))
+    for (uint32_t i = 0; i < numFunc; ++i) {
+        NativeVector wi(N, Q);
+        for (uint32_t j = 0; j < half; ++j) {
+            auto v{w[i][j] / g};
+            wi[j * factor] = v >= 0 ? NativeInteger(v) : Q - NativeInteger(-v);
+        }
+        NativePoly wPoly(polyParams, Format::COEFFICIENT, false);
+        wPoly.SetValues(std::move(wi), Format::COEFFICIENT);
+        wPoly.SetFormat(Format::EVALUATION);
+        std::vector<NativePoly> accVec{accElems[0] * wPoly, accElems[1] * wPoly};
+        result[i] = ExtractFunc(params, EK, accVec, fmod);
+    }
+    return result;
+}
+
+LWECiphertext BinFHEScheme::ExtractFunc(const std::shared_ptr<BinFHECryptoParams>& params, const RingGSWBTKey& EK,
+                                        std::vector<NativePoly>& accVec, NativeInteger fmod) const {
     // the accumulator result is encrypted w.r.t. the transposed secret key
     // we can transpose "a" to get an encryption under the original secret key
-    auto accVec{BootstrapFuncCore(params, EK.BSkey, ct, f, fmod)->GetElements()};
     accVec[0] = accVec[0].Transpose();
     accVec[0].SetFormat(Format::COEFFICIENT);
     accVec[1].SetFormat(Format::COEFFICIENT);
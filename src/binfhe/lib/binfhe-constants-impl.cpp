@@ -209,6 +209,9 @@ std::ostream& operator<<(std::ostream& s, BINFHE_METHOD f) {
         case LMKCDEY:
             s << "LMKCDEY";
             break;
+        case GINX_FFT:
+            s << "CGGI_FFT";
+            break;
         default:
             s << "UNKNOWN";
             break;
@@ -293,7 +296,7 @@ void isMethodCompatible(BINFHE_METHOD m, BINFHE_PARAMSET p) {
                 OPENFHE_THROW("Specified BINFHE_METHOD and BINFHE_PARAMSET are incompatible");
         }
     }
-    else if (m == AP || m == GINX) {
+    else if (m == AP || m == GINX || m == GINX_FFT) {
         switch (p) {
             case TOY:
             case MEDIUM:
@@ -337,6 +337,13 @@ LWECiphertext BinFHEContext::EvalFunc(ConstLWECiphertext& ct, const std::vector<
     return m_binfhescheme->EvalFunc(m_params, m_BTKey, ct, LUT, GetBeta());
 }
 
+std::vector<LWECiphertext> BinFHEContext::EvalMultiFunc(ConstLWECiphertext& ct,
+                                                        const std::vector<std::vector<NativeInteger>>& LUTs) const {
+    if (ct == nullptr)
+        OPENFHE_THROW("Ciphertext is empty");
+    return m_binfhescheme->EvalMultiFunc(m_params, m_BTKey, ct, LUTs, GetBeta());
+}
+
 LWECiphertext BinFHEContext::EvalFloor(ConstLWECiphertext& ct, uint32_t roundbits) const {
     //    auto q = m_params->GetLWEParams()->Getq().ConvertToInt();
     //    if (roundbits != 0) {
@@ -350,6 +357,10 @@ LWECiphertext BinFHEContext::EvalFloor(ConstLWECiphertext& ct, uint32_t roundbit
     return m_binfhescheme->EvalFloor(m_params, m_BTKey, ct, GetBeta(), roundbits);
 }
 
+std::vector<LWECiphertext> BinFHEContext::EvalFloor(const std::vector<LWECiphertext>& cts, uint32_t roundbits) const {
+    return m_binfhescheme->EvalFloor(m_params, m_BTKey, cts, GetBeta(), roundbits);
+}
+
 LWECiphertext BinFHEContext::EvalSign(ConstLWECiphertext& ct, bool schemeSwitch) {
     if (ct == nullptr)
         OPENFHE_THROW("Ciphertext is empty");
@@ -357,12 +368,21 @@ LWECiphertext BinFHEContext::EvalSign(ConstLWECiphertext& ct, bool schemeSwitch)
                                     schemeSwitch);
 }
 
+std::vector<LWECiphertext> BinFHEContext::EvalSign(const std::vector<LWECiphertext>& cts, bool schemeSwitch) {
+    return m_binfhescheme->EvalSign(std::make_shared<BinFHECryptoParams>(*m_params), m_BTKey_map, cts, GetBeta(),
+                                    schemeSwitch);
+}
+
 std::vector<LWECiphertext> BinFHEContext::EvalDecomp(ConstLWECiphertext& ct) {
     if (ct == nullptr)
         OPENFHE_THROW("Ciphertext is empty");
     return m_binfhescheme->EvalDecomp(m_params, m_BTKey_map, ct, GetBeta());
 }
 
+std::vector<std::vector<LWECiphertext>> BinFHEContext::EvalDecomp(const std::vector<LWECiphertext>& cts) {
+    return m_binfhescheme->EvalDecomp(m_params, m_BTKey_map, cts, GetBeta());
+}
+
 std::vector<NativeInteger> BinFHEContext::GenerateLUTviaFunction(NativeInteger (*f)(NativeInteger m, NativeInteger p),
                                                                  NativeInteger p) {
     if (!IsPowerOfTwo(p.ConvertToInt<BasicInteger>()))
@@ -0,0 +1,162 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+#include "rgsw-acc-cggi-fft.h"
+#include "rgsw-acc-cggi.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace lbcrypto {
+
+// The CGGI keys of https://eprint.iacr.org/2020/086 are kept in COEFFICIENT format and transformed to the FFT domain
+RingGSWACCKey RingGSWAccumulatorCGGIFFT::KeyGenAcc(const std::shared_ptr<RingGSWCryptoParams>& params,
+                                                   const NativePoly& skNTT, ConstLWEPrivateKey& LWEsk) const {
+    if (!params->GetFFT())
+        OPENFHE_THROW("FFT tables are not available for the specified bootstrapping method");
+    uint32_t n(LWEsk->GetElement().GetLength());
+    CheckPrecision(params, n);
+
+    auto ek{RingGSWAccumulatorCGGI().KeyGenAcc(params, skNTT, LWEsk)};
+    const auto& fft{*params->GetFFT()};
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(n))
+    for (uint32_t i = 0; i < n; ++i) {
+        for (uint32_t j = 0; j < 2; ++j) {
+            auto& key{(*ek)[0][j][i]};
+            key->SetFormat(Format::COEFFICIENT);
+            key->ComputeElementsFFT(fft);
+        }
+    }
+    return ek;
+}
+
+void RingGSWAccumulatorCGGIFFT::EvalAcc(const std::shared_ptr<RingGSWCryptoParams>& params, ConstRingGSWACCKey& ek,
+                                        RLWECiphertext& acc, const NativeVector& a) const {
+    if (!params->GetFFT())
+        OPENFHE_THROW("FFT tables are not available for the specified bootstrapping method");
+    if ((*ek)[0][0][0]->GetElementsFFT().empty())
+        OPENFHE_THROW("The refreshing key was not generated for the FFT accumulator");
+    uint32_t n(a.GetLength());
+    CheckPrecision(params, n);
+
+    auto mod{a.GetModulus()};
+    auto MbyMod{NativeInteger(2 * params->GetN()) / mod};
+    auto& accElems{acc->GetElements()};
+    accElems[0].SetFormat(Format::COEFFICIENT);
+    accElems[1].SetFormat(Format::COEFFICIENT);
+    FFTScratch scratch(params);
+    for (uint32_t i = 0; i < n; ++i) {
+        // handles -a*E(1) and handles -a*E(-1) = a*E(1)
+        auto index{(NativeInteger(0).ModSubFast(a[i], mod) * MbyMod).ConvertToInt<uint32_t>()};
+        AddToAccCGGIFFT(params, (*ek)[0][0][i], (*ek)[0][1][i], index, acc, scratch);
+    }
+    accElems[0].SetFormat(Format::EVALUATION);
+    accElems[1].SetFormat(Format::EVALUATION);
+}
+
+// Every coefficient of (X^a - 1) * (dct x ek1) + (X^-a - 1) * (dct x ek2) is bounded by
+// 4 * digitsG2 * N * (baseG / 2) * (Q / 2), and the double-precision FFT of size N/2 computes it with
+// an absolute error of about 2^-53 * log2(N) times that bound. The error of the n updates adds up in the
+// accumulator and is divided by Q/q by the modulus switching, so it is kept below 1/16.
+void RingGSWAccumulatorCGGIFFT::CheckPrecision(const std::shared_ptr<RingGSWCryptoParams>& params, uint32_t n) const {
+    double N{static_cast<double>(params->GetN())};
+    double Q{params->GetQ().ConvertToDouble()};
+    double digitsG2{static_cast<double>((params->GetDigitsG() - 1) << 1)};
+    double bound{4.0 * digitsG2 * N * (params->GetBaseG() / 2.0) * (Q / 2.0)};
+    double error{std::ldexp(bound, -53) * std::log2(N)};
+    if (n * error >= Q / (16.0 * params->Getq().ConvertToDouble()))
+        OPENFHE_THROW("The rounding error of the FFT accumulator is too large for these parameters; use GINX instead");
+}
+
+// CGGI Accumulation as described in https://eprint.iacr.org/2020/086
+// Added ternary MUX introduced in paper https://eprint.iacr.org/2022/074.pdf section 5
+// Both external products and both monomials are combined in the FFT domain, so that every update
+// needs digitsG2 forward and 2 inverse transforms of size N/2
+void RingGSWAccumulatorCGGIFFT::AddToAccCGGIFFT(const std::shared_ptr<RingGSWCryptoParams>& params,
+                                                ConstRingGSWEvalKey& ek1, ConstRingGSWEvalKey& ek2, uint32_t a,
+                                                RLWECiphertext& acc, FFTScratch& scratch) const {
+    const auto& fft{*params->GetFFT()};
+    auto& accElems{acc->GetElements()};
+    auto& dct{scratch.dct};
+    auto& dctFFT{scratch.dctFFT};
+    auto& sum{scratch.sum};
+
+    SignedDigitDecompose(params, accElems, dct);
+
+    uint32_t digitsG2{static_cast<uint32_t>(dct.size())};
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(digitsG2))
+    for (uint32_t i = 0; i < digitsG2; ++i)
+        fft.Forward(dct[i], dctFFT[i]);
+
+    // sum[j] = (dct x ek1)_j and sum[j + 2] = (dct x ek2)_j
+    uint32_t H{params->GetN() >> 1};
+    for (auto& s : sum)
+        std::fill(s.begin(), s.end(), 0.0);
+    const auto& ev1{ek1->GetElementsFFT()};
+    const auto& ev2{ek2->GetElementsFFT()};
+    for (uint32_t i = 0; i < digitsG2; ++i) {
+        auto* d{reinterpret_cast<const double*>(dctFFT[i].data())};
+        for (uint32_t k = 0; k < 4; ++k) {
+            auto* e{reinterpret_cast<const double*>((k < 2 ? ev1 : ev2)[i][k & 0x1].data())};
+            auto* s{reinterpret_cast<double*>(sum[k].data())};
+            for (uint32_t p = 0; p < 2 * H; p += 2) {
+                s[p] += d[p] * e[p] - d[p + 1] * e[p + 1];
+                s[p + 1] += d[p] * e[p + 1] + d[p + 1] * e[p];
+            }
+        }
+    }
+
+    // sum[j] = (X^a - 1) * sum[j] + (X^-a - 1) * sum[j + 2]
+    uint32_t aNeg{2 * params->GetN() - a};
+    for (uint32_t j = 0; j < 2; ++j) {
+        auto* s1{reinterpret_cast<double*>(sum[j].data())};
+        auto* s2{reinterpret_cast<const double*>(sum[j + 2].data())};
+        for (uint32_t p = 0; p < H; ++p) {
+            const auto& mPos{fft.MonomialAt(a, p)};
+            const auto& mNeg{fft.MonomialAt(aNeg, p)};
+            double pr{mPos.real() - 1.0};
+            double pi{mPos.imag()};
+            double nr{mNeg.real() - 1.0};
+            double ni{mNeg.imag()};
+            double r1{s1[2 * p]};
+            double i1{s1[2 * p + 1]};
+            s1[2 * p]     = pr * r1 - pi * i1 + nr * s2[2 * p] - ni * s2[2 * p + 1];
+            s1[2 * p + 1] = pr * i1 + pi * r1 + nr * s2[2 * p + 1] + ni * s2[2 * p];
+        }
+    }
+
+    fft.InverseAdd(sum[0], accElems[0]);
+    fft.InverseAdd(sum[1], accElems[1]);
+}
+
+};  // namespace lbcrypto
@@ -63,9 +63,11 @@ void RingGSWAccumulatorCGGI::EvalAcc(const std::shared_ptr<RingGSWCryptoParams>&
     uint32_t n(a.GetLength());
     auto mod{a.GetModulus()};
     auto MbyMod{NativeInteger(2 * params->GetN()) / mod};
+    RingGSWAccScratch scratch(params);
     for (uint32_t i = 0; i < n; ++i) {
         // handles -a*E(1) and handles -a*E(-1) = a*E(1)
-        AddToAccCGGI(params, (*ek)[0][0][i], (*ek)[0][1][i], NativeInteger(0).ModSubFast(a[i], mod) * MbyMod, acc);
+        AddToAccCGGI(params, (*ek)[0][0][i], (*ek)[0][1][i], NativeInteger(0).ModSubFast(a[i], mod) * MbyMod, acc,
+                     scratch);
     }
 }
 
@@ -102,14 +104,19 @@ RingGSWEvalKey RingGSWAccumulatorCGGI::KeyGenCGGI(const std::shared_ptr<RingGSWC
 // We optimize the algorithm by multiplying the monomial after the external product
 // This reduces the number of polynomial multiplications which further reduces the runtime
 void RingGSWAccumulatorCGGI::AddToAccCGGI(const std::shared_ptr<RingGSWCryptoParams>& params, ConstRingGSWEvalKey& ek1,
-                                          ConstRingGSWEvalKey& ek2, NativeInteger a, RLWECiphertext& acc) const {
-    std::vector<NativePoly> ct(acc->GetElements());
+                                          ConstRingGSWEvalKey& ek2, NativeInteger a, RLWECiphertext& acc,
+                                          RingGSWAccScratch& scratch) const {
+    auto& ct{scratch.ct};
+    ct[0] = acc->GetElements()[0];
+    ct[1] = acc->GetElements()[1];
     ct[0].SetFormat(Format::COEFFICIENT);
     ct[1].SetFormat(Format::COEFFICIENT);
 
     // approximate gadget decomposition is used; the first digit is ignored
     uint32_t digitsG2{(params->GetDigitsG() - 1) << 1};
-    std::vector<NativePoly> dct(digitsG2, NativePoly(params->GetPolyParams(), Format::COEFFICIENT, true));
+    auto& dct{scratch.dct};
+    for (uint32_t i = 0; i < digitsG2; ++i)
+        dct[i].OverrideFormat(Format::COEFFICIENT);
 
     SignedDigitDecompose(params, ct, dct);
 
@@ -127,29 +134,16 @@ void RingGSWAccumulatorCGGI::AddToAccCGGI(const std::shared_ptr<RingGSWCryptoPar
     const NativePoly& monomialNeg = params->GetMonomial(indexNeg == MInt ? 0 : indexNeg);
 
     // acc = acc + dct * ek1 * monomial + dct * ek2 * negative_monomial;
-    // uses in-place * operators for the last call to dct[i] to gain performance
-    // improvement. Needs to be done using two loops for ternary secrets.
-    // TODO (dsuponit): benchmark cases with operator*() and operator*=(). Make a copy of dct?
-
-    const std::vector<std::vector<NativePoly>>& ev1(ek1->GetElements());
-    NativePoly tmp(dct[0] * ev1[0][0]);
-    for (uint32_t i = 1; i < digitsG2; ++i)
-        tmp += (dct[i] * ev1[i][0]);
-    acc->GetElements()[0] += (tmp *= monomial);
-    tmp = (dct[0] * ev1[0][1]);
-    for (uint32_t i = 1; i < digitsG2; ++i)
-        tmp += (dct[i] * ev1[i][1]);
-    acc->GetElements()[1] += (tmp *= monomial);
-
-    const std::vector<std::vector<NativePoly>>& ev2(ek2->GetElements());
-    tmp = (dct[0] * ev2[0][0]);
-    for (uint32_t i = 1; i < digitsG2; ++i)
-        tmp += (dct[i] * ev2[i][0]);
-    acc->GetElements()[0] += (tmp *= monomialNeg);
-    tmp = (dct[0] * ev2[0][1]);
-    for (uint32_t i = 1; i < digitsG2; ++i)
-        tmp += (dct[i] *= ev2[i][1]);
-    acc->GetElements()[1] += (tmp *= monomialNeg);
+    // the monomial is multiplied after the external product. Needs to be done using two products for ternary
+    // secrets.
+    auto& sum{scratch.sum};
+    ExternalProduct(dct, ek1->GetElements(), digitsG2, sum);
+    acc->GetElements()[0] += (sum[0] *= monomial);
+    acc->GetElements()[1] += (sum[1] *= monomial);
+
+    ExternalProduct(dct, ek2->GetElements(), digitsG2, sum);
+    acc->GetElements()[0] += (sum[0] *= monomialNeg);
+    acc->GetElements()[1] += (sum[1] *= monomialNeg);
 }
 
 };  // namespace lbcrypto
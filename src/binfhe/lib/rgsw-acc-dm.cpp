@@ -66,12 +66,13 @@ void RingGSWAccumulatorDM::EvalAcc(const std::shared_ptr<RingGSWCryptoParams>& p
     auto digitsR = params->GetDigitsR().size();
     uint32_t n   = a.GetLength();
 
+    RingGSWAccScratch scratch(params);
     for (uint32_t i = 0; i < n; ++i) {
         auto aI = NativeInteger(0).ModSubFast(a[i], q);
         for (size_t k = 0; k < digitsR; ++k, aI /= baseR) {
             auto a0 = (aI.Mod(baseR)).ConvertToInt<uint32_t>();
             if (a0)
-                AddToAccDM(params, (*ek)[i][a0][k], acc);
+                AddToAccDM(params, (*ek)[i][a0][k], acc, scratch);
         }
     }
 }
@@ -116,14 +117,18 @@ RingGSWEvalKey RingGSWAccumulatorDM::KeyGenDM(const std::shared_ptr<RingGSWCrypt
 
 // AP Accumulation as described in https://eprint.iacr.org/2020/086
 void RingGSWAccumulatorDM::AddToAccDM(const std::shared_ptr<RingGSWCryptoParams>& params, ConstRingGSWEvalKey& ek,
-                                      RLWECiphertext& acc) const {
-    std::vector<NativePoly> ct(acc->GetElements());
+                                      RLWECiphertext& acc, RingGSWAccScratch& scratch) const {
+    auto& ct{scratch.ct};
+    ct[0] = acc->GetElements()[0];
+    ct[1] = acc->GetElements()[1];
     ct[0].SetFormat(Format::COEFFICIENT);
     ct[1].SetFormat(Format::COEFFICIENT);
 
     // approximate gadget decomposition is used; the first digit is ignored
     uint32_t digitsG2{(params->GetDigitsG() - 1) << 1};
-    std::vector<NativePoly> dct(digitsG2, NativePoly(params->GetPolyParams(), Format::COEFFICIENT, true));
+    auto& dct{scratch.dct};
+    for (uint32_t j = 0; j < digitsG2; ++j)
+        dct[j].OverrideFormat(Format::COEFFICIENT);
 
     SignedDigitDecompose(params, ct, dct);
 
@@ -131,15 +136,8 @@ void RingGSWAccumulatorDM::AddToAccDM(const std::shared_ptr<RingGSWCryptoParams>
     for (uint32_t j = 0; j < digitsG2; ++j)
         dct[j].SetFormat(Format::EVALUATION);
 
-    // acc = dct * ek (matrix product);
-    // uses in-place * operators for the last call to dct[i] to gain performance improvement
-    const std::vector<std::vector<NativePoly>>& ev = ek->GetElements();
-    acc->GetElements()[0]                          = (dct[0] * ev[0][0]);
-    for (uint32_t l = 1; l < digitsG2; ++l)
-        acc->GetElements()[0] += (dct[l] * ev[l][0]);
-    acc->GetElements()[1] = (dct[0] *= ev[0][1]);
-    for (uint32_t l = 1; l < digitsG2; ++l)
-        acc->GetElements()[1] += (dct[l] *= ev[l][1]);
+    // acc = dct * ek (matrix product), written directly into the accumulator
+    ExternalProduct(dct, ek->GetElements(), digitsG2, acc->GetElements());
 }
 
 };  // namespace lbcrypto
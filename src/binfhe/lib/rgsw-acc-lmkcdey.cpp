@@ -91,27 +91,28 @@ void RingGSWAccumulatorLMKCDEY::EvalAcc(const std::shared_ptr<RingGSWCryptoParam
         indexVec.push_back(i);
     }
 
-    NativeInteger gen(5);
     uint32_t genInt       = 5;
     uint32_t nSkips       = 0;
     acc->GetElements()[1] = (acc->GetElements()[1]).AutomorphismTransform(M - genInt);
 
+    RingGSWAccScratch scratch(params);
+
     // for a_j = -5^i
     for (uint32_t i = Nh - 1; i > 0; i--) {
         if (permuteMap.find(-i) != permuteMap.end()) {
             if (nSkips != 0) {  // Rotation by 5^nSkips
-                Automorphism(params, gen.ModExp(nSkips, M), (*ek)[0][1][nSkips], acc);
+                Automorphism(params, params->GetAutoMap(nSkips), (*ek)[0][1][nSkips], acc, scratch);
                 nSkips = 0;
             }
             auto& indexVec = permuteMap[-i];
             for (size_t j = 0; j < indexVec.size(); j++) {
-                AddToAccLMKCDEY(params, (*ek)[0][0][indexVec[j]], acc);
+                AddToAccLMKCDEY(params, (*ek)[0][0][indexVec[j]], acc, scratch);
             }
         }
         nSkips++;
 
         if (nSkips == numAutoKeys || i == 1) {
-            Automorphism(params, gen.ModExp(nSkips, M), (*ek)[0][1][nSkips], acc);
+            Automorphism(params, params->GetAutoMap(nSkips), (*ek)[0][1][nSkips], acc, scratch);
             nSkips = 0;
         }
     }
@@ -120,28 +121,28 @@ void RingGSWAccumulatorLMKCDEY::EvalAcc(const std::shared_ptr<RingGSWCryptoParam
     if (permuteMap.find(M) != permuteMap.end()) {
         auto& indexVec = permuteMap[M];
         for (size_t j = 0; j < indexVec.size(); j++) {
-            AddToAccLMKCDEY(params, (*ek)[0][0][indexVec[j]], acc);
+            AddToAccLMKCDEY(params, (*ek)[0][0][indexVec[j]], acc, scratch);
         }
     }
 
-    Automorphism(params, NativeInteger(M - genInt), (*ek)[0][1][0], acc);
+    Automorphism(params, params->GetAutoMap(0), (*ek)[0][1][0], acc, scratch);
     // for a_j = 5^i
     for (size_t i = Nh - 1; i > 0; i--) {
         if (permuteMap.find(i) != permuteMap.end()) {
             if (nSkips != 0) {  // Rotation by 5^nSkips
-                Automorphism(params, gen.ModExp(nSkips, M), (*ek)[0][1][nSkips], acc);
+                Automorphism(params, params->GetAutoMap(nSkips), (*ek)[0][1][nSkips], acc, scratch);
                 nSkips = 0;
             }
 
             auto& indexVec = permuteMap[i];
             for (size_t j = 0; j < indexVec.size(); j++) {
-                AddToAccLMKCDEY(params, (*ek)[0][0][indexVec[j]], acc);
+                AddToAccLMKCDEY(params, (*ek)[0][0][indexVec[j]], acc, scratch);
             }
         }
         nSkips++;
 
         if (nSkips == numAutoKeys || i == 1) {
-            Automorphism(params, gen.ModExp(nSkips, M), (*ek)[0][1][nSkips], acc);
+            Automorphism(params, params->GetAutoMap(nSkips), (*ek)[0][1][nSkips], acc, scratch);
             nSkips = 0;
         }
     }
@@ -150,7 +151,7 @@ void RingGSWAccumulatorLMKCDEY::EvalAcc(const std::shared_ptr<RingGSWCryptoParam
     if (permuteMap.find(0) != permuteMap.end()) {
         auto& indexVec = permuteMap[0];
         for (size_t j = 0; j < indexVec.size(); j++) {
-            AddToAccLMKCDEY(params, (*ek)[0][0][indexVec[j]], acc);
+            AddToAccLMKCDEY(params, (*ek)[0][0][indexVec[j]], acc, scratch);
         }
     }
 }
@@ -218,15 +219,19 @@ RingGSWEvalKey RingGSWAccumulatorLMKCDEY::KeyGenAuto(const std::shared_ptr<RingG
 // LMKCDEY Accumulation as described in https://eprint.iacr.org/2022/198
 // Same as AP, but multiplied once
 void RingGSWAccumulatorLMKCDEY::AddToAccLMKCDEY(const std::shared_ptr<RingGSWCryptoParams>& params,
-                                                ConstRingGSWEvalKey& ek, RLWECiphertext& acc) const {
-    std::vector<NativePoly> ct(acc->GetElements());
+                                                ConstRingGSWEvalKey& ek, RLWECiphertext& acc,
+                                                RingGSWAccScratch& scratch) const {
+    auto& ct{scratch.ct};
+    ct[0] = acc->GetElements()[0];
+    ct[1] = acc->GetElements()[1];
     ct[0].SetFormat(Format::COEFFICIENT);
     ct[1].SetFormat(Format::COEFFICIENT);
 
     // approximate gadget decomposition is used; the first digit is ignored
     uint32_t digitsG2{(params->GetDigitsG() - 1) << 1};
-
-    std::vector<NativePoly> dct(digitsG2, NativePoly(params->GetPolyParams(), Format::COEFFICIENT, true));
+    auto& dct{scratch.dct};
+    for (uint32_t d = 0; d < digitsG2; ++d)
+        dct[d].OverrideFormat(Format::COEFFICIENT);
 
     SignedDigitDecompose(params, ct, dct);
 
@@ -235,47 +240,41 @@ void RingGSWAccumulatorLMKCDEY::AddToAccLMKCDEY(const std::shared_ptr<RingGSWCry
     for (uint32_t d = 0; d < digitsG2; ++d)
         dct[d].SetFormat(Format::EVALUATION);
 
-    // acc = dct * ek (matrix product);
-    const auto& ev        = ek->GetElements();
-    acc->GetElements()[0] = (dct[0] * ev[0][0]);
-    for (uint32_t d = 1; d < digitsG2; ++d)
-        acc->GetElements()[0] += (dct[d] * ev[d][0]);
-    acc->GetElements()[1] = (dct[0] *= ev[0][1]);
-    for (uint32_t d = 1; d < digitsG2; ++d)
-        acc->GetElements()[1] += (dct[d] *= ev[d][1]);
+    // acc = dct * ek (matrix product), written directly into the accumulator
+    ExternalProduct(dct, ek->GetElements(), digitsG2, acc->GetElements());
 }
 
 // Automorphism
-void RingGSWAccumulatorLMKCDEY::Automorphism(const std::shared_ptr<RingGSWCryptoParams>& params, NativeInteger a,
-                                             ConstRingGSWEvalKey& ak, RLWECiphertext& acc) const {
-    // precompute bit reversal for the automorphism into vec
+void RingGSWAccumulatorLMKCDEY::Automorphism(const std::shared_ptr<RingGSWCryptoParams>& params,
+                                             const std::vector<uint32_t>& autoMap, ConstRingGSWEvalKey& ak,
+                                             RLWECiphertext& acc, RingGSWAccScratch& scratch) const {
+    // apply the automorphism to both accumulator elements (EVALUATION representation) using the precomputed map
+    auto& ct{scratch.ct};
+    auto& accElems{acc->GetElements()};
     uint32_t N{params->GetN()};
-    std::vector<usint> vec(N);
-    PrecomputeAutoMap(N, a.ConvertToInt<usint>(), &vec);
-
-    acc->GetElements()[1] = acc->GetElements()[1].AutomorphismTransform(a.ConvertToInt<usint>(), vec);
-
-    NativePoly cta(acc->GetElements()[0]);
-    acc->GetElements()[0].SetValuesToZero();
-    cta = cta.AutomorphismTransform(a.ConvertToInt<usint>(), vec);
-    cta.SetFormat(COEFFICIENT);
+    for (uint32_t j = 0; j < N; ++j) {
+        ct[0][j] = accElems[0][autoMap[j]];
+        ct[1][j] = accElems[1][autoMap[j]];
+    }
+    ct[0].OverrideFormat(Format::EVALUATION);
+    ct[1].OverrideFormat(Format::EVALUATION);
+    ct[0].SetFormat(COEFFICIENT);
 
     // approximate gadget decomposition is used; the first digit is ignored
     uint32_t digitsG{params->GetDigitsG() - 1};
-    std::vector<NativePoly> dcta(digitsG, NativePoly(params->GetPolyParams(), Format::COEFFICIENT, true));
+    auto& dcta{scratch.dct};
+    for (uint32_t d = 0; d < digitsG; ++d)
+        dcta[d].OverrideFormat(Format::COEFFICIENT);
 
-    SignedDigitDecompose(params, cta, dcta);
+    SignedDigitDecompose(params, ct[0], dcta);
 
 #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(digitsG))
     for (uint32_t d = 0; d < digitsG; ++d)
         dcta[d].SetFormat(Format::EVALUATION);
 
-    // acc = dct * input (matrix product);
-    const auto& ev = ak->GetElements();
-    for (uint32_t d = 0; d < digitsG; ++d)
-        acc->GetElements()[0] += (dcta[d] * ev[d][0]);
-    for (uint32_t d = 0; d < digitsG; ++d)
-        acc->GetElements()[1] += (dcta[d] *= ev[d][1]);
+    // acc = (0, automorphism of acc[1]) + dcta * ak (matrix product)
+    ExternalProduct(dcta, ak->GetElements(), digitsG, accElems);
+    accElems[1] += ct[1];
 }
 
 };  // namespace lbcrypto
@@ -80,13 +80,13 @@ void RingGSWAccumulator::SignedDigitDecompose(const std::shared_ptr<RingGSWCrypt
             d0 = (d0 - r0) >> gBits;
             if (r0 < 0)
                 r0 += Q_int;
-            output[d + 0][k] += r0;
+            output[d + 0][k] = r0;
 
             r1 = (d1 << gBitsMaxBits) >> gBitsMaxBits;
             d1 = (d1 - r1) >> gBits;
             if (r1 < 0)
                 r1 += Q_int;
-            output[d + 1][k] += r1;
+            output[d + 1][k] = r1;
         }
     }
 }
@@ -114,9 +114,35 @@ void RingGSWAccumulator::SignedDigitDecompose(const std::shared_ptr<RingGSWCrypt
             d0 = (d0 - r0) >> gBits;
             if (r0 < 0)
                 r0 += Q_int;
-            output[d][k] += r0;
+            output[d][k] = r0;
         }
     }
 }
 
+void RingGSWAccumulator::ExternalProduct(const std::vector<NativePoly>& dct,
+                                         const std::vector<std::vector<NativePoly>>& ev, uint32_t digits,
+                                         std::vector<NativePoly>& out) const {
+    const auto& Q{dct[0].GetParams()->GetModulus()};
+    auto qInv{Q.ComputeMontgomeryInverse()};
+    // each Montgomery product carries a factor R^{-1}; one REDC with R^2 mod Q removes it from the sum
+    auto r2{NativeInteger(1).ToMontgomery(Q).ToMontgomery(Q)};
+    uint32_t N{dct[0].GetLength()};
+
+    for (uint32_t j = 0; j < 2; ++j) {
+        auto& acc{out[j]};
+        acc.OverrideFormat(Format::EVALUATION);
+        const auto& e0{ev[0][j]};
+        for (uint32_t k = 0; k < N; ++k)
+            acc[k] = dct[0][k].ModMulMontgomery(e0[k], Q, qInv);
+        for (uint32_t d = 1; d < digits; ++d) {
+            const auto& x{dct[d]};
+            const auto& e{ev[d][j]};
+            for (uint32_t k = 0; k < N; ++k)
+                acc[k].ModAddFastEq(x[k].ModMulMontgomery(e[k], Q, qInv), Q);
+        }
+        for (uint32_t k = 0; k < N; ++k)
+            acc[k].ModMulMontgomeryEq(r2, Q, qInv);
+    }
+}
+
 };  // namespace lbcrypto
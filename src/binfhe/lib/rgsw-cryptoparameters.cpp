@@ -112,6 +112,10 @@ void RingGSWCryptoParams::PreCompute(bool signEval) {
         }
     }
 
+    // The CGGI accumulator with the FFT external product works on the FFT tables instead of the monomials
+    if (m_method == BINFHE_METHOD::GINX_FFT)
+        m_fft = std::make_shared<NegacyclicFFT>(m_N);
+
     if (m_method == LMKCDEY) {
         constexpr uint32_t gen{5};
         m_logGen.clear();
@@ -124,6 +128,15 @@ void RingGSWCryptoParams::PreCompute(bool signEval) {
             m_logGen[gPow]     = i;
             m_logGen[M - gPow] = -i;
         }
+
+        m_autoMaps.clear();
+        m_autoMaps.resize(m_numAutoKeys + 1, std::vector<uint32_t>(m_N));
+        PrecomputeAutoMap(m_N, M - gen, &m_autoMaps[0]);
+        gPow = 1;
+        for (uint32_t i = 1; i <= m_numAutoKeys; ++i) {
+            gPow = (gPow * gen) % M;
+            PrecomputeAutoMap(m_N, gPow, &m_autoMaps[i]);
+        }
     }
 }
 
@@ -0,0 +1,166 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+#include "rgsw-fft.h"
+#include "rgsw-evalkey.h"
+
+#include "math/nbtheory.h"
+#include "utils/exception.h"
+#include "utils/utilities.h"
+
+#include <cmath>
+#include <vector>
+
+namespace lbcrypto {
+
+NegacyclicFFT::NegacyclicFFT(uint32_t N) : m_N(N) {
+    if (N < 4 || !IsPowerOfTwo(N))
+        OPENFHE_THROW("Ring dimension for the FFT should be a power of two no smaller than 4");
+
+    uint32_t H{N >> 1};
+    uint32_t logH{0};
+    while ((1u << logH) < H)
+        ++logH;
+
+    const double angle{std::acos(-1.0) / N};
+    m_zetaPow.resize(2 * N);
+    for (uint32_t m = 0; m < 2 * N; ++m)
+        m_zetaPow[m] = {std::cos(angle * m), std::sin(angle * m)};
+
+    m_rootExp.resize(H);
+    for (uint32_t p = 0; p < H; ++p)
+        m_rootExp[p] = 1 + 4 * ReverseBits(p, logH);
+
+    m_twiddles.resize(H >> 1);
+    for (uint32_t t = 0; t < (H >> 1); ++t)
+        m_twiddles[t] = m_zetaPow[4 * t];
+
+    m_twist.resize(H);
+    m_untwist.resize(H);
+    for (uint32_t j = 0; j < H; ++j) {
+        m_twist[j]   = m_zetaPow[j];
+        m_untwist[j] = std::conj(m_zetaPow[j]) / static_cast<double>(H);
+    }
+}
+
+void NegacyclicFFT::Forward(const NativePoly& a, Spectrum& out) const {
+    uint32_t H{m_N >> 1};
+    auto Q{a.GetModulus().ConvertToInt<int64_t>()};
+    auto QHalf{Q >> 1};
+    out.resize(H);
+    auto* x{reinterpret_cast<double*>(out.data())};
+    auto* w{reinterpret_cast<const double*>(m_twist.data())};
+    for (uint32_t j = 0; j < H; ++j) {
+        auto lo{a[j].ConvertToInt<int64_t>()};
+        auto hi{a[j + H].ConvertToInt<int64_t>()};
+        double re{static_cast<double>(lo > QHalf ? lo - Q : lo)};
+        double im{static_cast<double>(hi > QHalf ? hi - Q : hi)};
+        x[2 * j]     = re * w[2 * j] - im * w[2 * j + 1];
+        x[2 * j + 1] = re * w[2 * j + 1] + im * w[2 * j];
+    }
+    TransformInPlace(out);
+}
+
+void NegacyclicFFT::InverseAdd(Spectrum& in, NativePoly& a) const {
+    InverseTransformInPlace(in);
+    uint32_t H{m_N >> 1};
+    const auto& Q{a.GetModulus()};
+    auto q{Q.ConvertToInt<int64_t>()};
+    auto* x{reinterpret_cast<const double*>(in.data())};
+    auto* w{reinterpret_cast<const double*>(m_untwist.data())};
+    for (uint32_t j = 0; j < H; ++j) {
+        double re{x[2 * j] * w[2 * j] - x[2 * j + 1] * w[2 * j + 1]};
+        double im{x[2 * j] * w[2 * j + 1] + x[2 * j + 1] * w[2 * j]};
+        int64_t lo{std::llround(re) % q};
+        int64_t hi{std::llround(im) % q};
+        a[j].ModAddFastEq(NativeInteger(static_cast<BasicInteger>(lo < 0 ? lo + q : lo)), Q);
+        a[j + H].ModAddFastEq(NativeInteger(static_cast<BasicInteger>(hi < 0 ? hi + q : hi)), Q);
+    }
+}
+
+// decimation in frequency: natural order in, bit-reversed order out
+void NegacyclicFFT::TransformInPlace(Spectrum& a) const {
+    uint32_t H{m_N >> 1};
+    auto* x{reinterpret_cast<double*>(a.data())};
+    auto* w{reinterpret_cast<const double*>(m_twiddles.data())};
+    for (uint32_t len = H, step = 1; len > 1; len >>= 1, step <<= 1) {
+        uint32_t half{len >> 1};
+        for (uint32_t s = 0; s < H; s += len) {
+            double* lo{x + 2 * s};
+            double* hi{lo + len};
+            for (uint32_t j = 0; j < half; ++j) {
+                double wr{w[2 * j * step]};
+                double wi{w[2 * j * step + 1]};
+                double dr{lo[2 * j] - hi[2 * j]};
+                double di{lo[2 * j + 1] - hi[2 * j + 1]};
+                lo[2 * j] += hi[2 * j];
+                lo[2 * j + 1] += hi[2 * j + 1];
+                hi[2 * j]     = dr * wr - di * wi;
+                hi[2 * j + 1] = dr * wi + di * wr;
+            }
+        }
+    }
+}
+
+// decimation in time with conjugate twiddles: bit-reversed order in, natural order out (unscaled)
+void NegacyclicFFT::InverseTransformInPlace(Spectrum& a) const {
+    uint32_t H{m_N >> 1};
+    auto* x{reinterpret_cast<double*>(a.data())};
+    auto* w{reinterpret_cast<const double*>(m_twiddles.data())};
+    for (uint32_t len = 2, step = H >> 1; len <= H; len <<= 1, step >>= 1) {
+        uint32_t half{len >> 1};
+        for (uint32_t s = 0; s < H; s += len) {
+            double* lo{x + 2 * s};
+            double* hi{lo + len};
+            for (uint32_t j = 0; j < half; ++j) {
+                double wr{w[2 * j * step]};
+                double wi{w[2 * j * step + 1]};
+                double vr{hi[2 * j] * wr + hi[2 * j + 1] * wi};
+                double vi{hi[2 * j + 1] * wr - hi[2 * j] * wi};
+                hi[2 * j]     = lo[2 * j] - vr;
+                hi[2 * j + 1] = lo[2 * j + 1] - vi;
+                lo[2 * j] += vr;
+                lo[2 * j + 1] += vi;
+            }
+        }
+    }
+}
+
+void RingGSWEvalKeyImpl::ComputeElementsFFT(const NegacyclicFFT& fft) {
+    m_elementsFFT.resize(m_elements.size());
+    for (size_t i = 0; i < m_elements.size(); ++i) {
+        m_elementsFFT[i].resize(m_elements[i].size());
+        for (size_t j = 0; j < m_elements[i].size(); ++j)
+            fft.Forward(m_elements[i][j], m_elementsFFT[i][j]);
+    }
+}
+
+};  // namespace lbcrypto
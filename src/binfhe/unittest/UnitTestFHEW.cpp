@@ -172,51 +172,63 @@ static std::vector<TEST_CASE_UTGENERAL_FHEW> testCasesUTGENERAL_FHEW = {
     { FHEW_AND,  "01",   TOY,      GINX,    2,              4,        AND,   {1, 0, 0, 0} },
     { FHEW_AND,  "02",   TOY,      AP,      2,              4,        AND,   {1, 0, 0, 0} },
     { FHEW_AND,  "03",   TOY,      LMKCDEY, 2,              4,        AND,   {1, 0, 0, 0} },
+    { FHEW_AND,  "04",   TOY,      GINX_FFT, 2,              4,        AND,   {1, 0, 0, 0} },
     // ==========================================
     { FHEW_NAND, "01",   TOY,      GINX,    2,              4,        NAND,  {0, 1, 1, 1} },
     { FHEW_NAND, "02",   TOY,      AP,      2,              4,        NAND,  {0, 1, 1, 1} },
     { FHEW_NAND, "03",   TOY,      LMKCDEY, 2,              4,        NAND,  {0, 1, 1, 1} },
+    { FHEW_NAND, "04",   TOY,      GINX_FFT, 2,              4,        NAND,  {0, 1, 1, 1} },
     // ==========================================
     { FHEW_OR,   "01",   TOY,      GINX,    2,              4,        OR,    {1, 1, 1, 0} },
     { FHEW_OR,   "02",   TOY,      AP,      2,              4,        OR,    {1, 1, 1, 0} },
     { FHEW_OR,   "03",   TOY,      LMKCDEY, 2,              4,        OR,    {1, 1, 1, 0} },
+    { FHEW_OR,   "04",   TOY,      GINX_FFT, 2,              4,        OR,    {1, 1, 1, 0} },
     // ==========================================
     { FHEW_NOR,  "01",   TOY,      GINX,    2,              4,        NOR,   {0, 0, 0, 1} },
     { FHEW_NOR,  "02",   TOY,      AP,      2,              4,        NOR,   {0, 0, 0, 1} },
     { FHEW_NOR,  "03",   TOY,      LMKCDEY, 2,              4,        NOR,   {0, 0, 0, 1} },
+    { FHEW_NOR,  "04",   TOY,      GINX_FFT, 2,              4,        NOR,   {0, 0, 0, 1} },
     // ==========================================
     { FHEW_XOR,  "01",   TOY,      GINX,    2,              4,        XOR,   {0, 1, 1, 0} },
     { FHEW_XOR,  "02",   TOY,      AP,      2,              4,        XOR,   {0, 1, 1, 0} },
     { FHEW_XOR,  "03",   TOY,      LMKCDEY, 2,              4,        XOR,   {0, 1, 1, 0} },
+    { FHEW_XOR,  "04",   TOY,      GINX_FFT, 2,              4,        XOR,   {0, 1, 1, 0} },
     // ==========================================
 
     { FHEW_XNOR,  "01",  TOY,      GINX,    2,              4,        XNOR,  {1, 0, 0, 1} },
     { FHEW_XNOR,  "02",  TOY,      AP,      2,              4,        XNOR,  {1, 0, 0, 1} },
     { FHEW_XNOR,  "03",  TOY,      LMKCDEY, 2,              4,        XNOR,  {1, 0, 0, 1} },
+    { FHEW_XNOR,  "04",  TOY,      GINX_FFT, 2,              4,        XNOR,  {1, 0, 0, 1} },
     // ==========================================
     { FHEW_AND3, "01", TOY,      GINX,         3,           6,        AND3,      {0} },
     { FHEW_AND3, "02", TOY,      AP,           3,           6,        AND3,      {0} },
     { FHEW_AND3, "03", TOY,      LMKCDEY,      3,           6,        AND3,      {0} },
+    { FHEW_AND3, "04", TOY,      GINX_FFT,     3,           6,        AND3,      {0} },
     // ==========================================
     { FHEW_OR3, "01", TOY,      GINX,         3,            6,        OR3,      {1} },
     { FHEW_OR3, "02", TOY,      AP,           3,            6,        OR3,      {1} },
     { FHEW_OR3, "03", TOY,      LMKCDEY,      3,            6,        OR3,      {1} },
+    { FHEW_OR3, "04", TOY,      GINX_FFT,     3,            6,        OR3,      {1} },
     // ==========================================
     { FHEW_AND4, "01", TOY,      GINX,         4,           8,        AND4,      {0} },
     { FHEW_AND4, "02", TOY,      AP,           4,           8,        AND4,      {0} },
     { FHEW_AND4, "03", TOY,      LMKCDEY,      4,           8,        AND4,      {0} },
+    { FHEW_AND4, "04", TOY,      GINX_FFT,     4,           8,        AND4,      {0} },
     // ==========================================
     { FHEW_OR4, "01", TOY,      GINX,         4,            8,        OR4,      {1} },
     { FHEW_OR4, "02", TOY,      AP,           4,            8,        OR4,      {1} },
     { FHEW_OR4, "03", TOY,      LMKCDEY,      4,            8,        OR4,      {1} },
+    { FHEW_OR4, "04", TOY,      GINX_FFT,     4,            8,        OR4,      {1} },
     // ==========================================
     { FHEW_MAJORITY, "01", TOY,      GINX,       3,         4,        MAJORITY,      {1} },
     { FHEW_MAJORITY, "02", TOY,      AP,         3,         4,        MAJORITY,      {1} },
     { FHEW_MAJORITY, "03", TOY,      LMKCDEY,    3,         4,        MAJORITY,      {1} },
+    { FHEW_MAJORITY, "04", TOY,      GINX_FFT,   3,         4,        MAJORITY,      {1} },
     // ==========================================
     { FHEW_CMUX, "01", TOY,      GINX,         3,           4,        CMUX,      {1, 0} },
     { FHEW_CMUX, "02", TOY,      AP,           3,           4,        CMUX,      {1, 0} },
     { FHEW_CMUX, "03", TOY,      LMKCDEY,      3,           4,        CMUX,      {1, 0} },
+    { FHEW_CMUX, "04", TOY,      GINX_FFT,     3,           4,        CMUX,      {1, 0} },
     // ==========================================
     { FHEW_SIGNED_MODE, "01", SIGNED_MOD_TEST, GINX, 2,     4,        AND, {1, 0, 0, 0} },
     // ==========================================
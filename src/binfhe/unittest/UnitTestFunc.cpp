@@ -67,6 +67,41 @@ TEST(UnitTestFHEWGINX, EvalArbFunc) {
 }
 
 // Checks the rounding down evaluation
+TEST(UnitTestFHEWGINX, EvalMultiFunc) {
+    auto cc = BinFHEContext();
+    cc.GenerateBinFHEContext(TOY, true, 12);
+    auto sk = cc.KeyGen();
+    cc.BTKeyGen(sk);
+    uint32_t p = cc.GetMaxPlaintextSpace().ConvertToInt();
+    auto fcube = [](NativeInteger m, NativeInteger p1) -> NativeInteger {
+        return (m * m * m) % p1;
+    };
+    auto fsquare = [](NativeInteger m, NativeInteger p1) -> NativeInteger {
+        return (m * m) % p1;
+    };
+    auto finc = [](NativeInteger m, NativeInteger p1) -> NativeInteger {
+        return (m + 1) % p1;
+    };
+    std::vector<std::vector<NativeInteger>> luts = {cc.GenerateLUTviaFunction(fcube, p),
+                                                    cc.GenerateLUTviaFunction(fsquare, p),
+                                                    cc.GenerateLUTviaFunction(finc, p)};
+
+    for (uint32_t i = 0; i < p; ++i) {
+        auto ct1 = cc.Encrypt(sk, i, LARGE_DIM, p);
+
+        auto cts = cc.EvalMultiFunc(ct1, luts);
+        ASSERT_EQ(luts.size(), cts.size());
+
+        std::vector<LWEPlaintext> results(cts.size());
+        for (size_t j = 0; j < cts.size(); ++j)
+            cc.Decrypt(sk, cts[j], &results[j], p);
+        std::string failed = "Multi-Function Evaluation failed";
+        EXPECT_EQ(LWEPlaintext(fcube(i, p).ConvertToInt()), results[0]) << failed;
+        EXPECT_EQ(LWEPlaintext(fsquare(i, p).ConvertToInt()), results[1]) << failed;
+        EXPECT_EQ(LWEPlaintext(finc(i, p).ConvertToInt()), results[2]) << failed;
+    }
+}
+
 TEST(UnitTestFHEWGINX, EvalFloorFunc) {
     auto cc = BinFHEContext();
     cc.GenerateBinFHEContext(TOY, false, 12);
@@ -140,6 +175,31 @@ TEST(UnitTestFHEWGINX, EvalSignFuncSpace) {
 }
 
 // Checks the digit decomposition evaluation
+TEST(UnitTestFHEWGINX, EvalSignFuncBatch) {
+    auto cc = BinFHEContext();
+    cc.GenerateBinFHEContext(TOY, false, 29, 0, GINX, false);
+
+    uint32_t Q = 1 << 29;
+    int q      = 4096;
+    int factor = 1 << int(29 - std::log2(q));
+    int p      = cc.GetMaxPlaintextSpace().ConvertToInt();
+    auto sk    = cc.KeyGen();
+    cc.BTKeyGen(sk);
+
+    std::string failed = "Batched Large Precision Sign Evalution failed";
+
+    std::vector<LWECiphertext> cts;
+    for (int i = 0; i < 8; ++i)
+        cts.push_back(cc.Encrypt(sk, p * factor / 2 + i - 3, LARGE_DIM, p * factor, Q));
+    auto signs = cc.EvalSign(cts);
+    ASSERT_EQ(cts.size(), signs.size()) << failed;
+    for (int i = 0; i < 8; ++i) {
+        LWEPlaintext result;
+        cc.Decrypt(sk, signs[i], &result, 2);
+        EXPECT_EQ(LWEPlaintext(i >= 3), result) << failed;
+    }
+}
+
 TEST(UnitTestFHEWGINX, EvalDigitDecompTime) {
     auto cc = BinFHEContext();
     cc.GenerateBinFHEContext(TOY, false, 29, 0, GINX, true);
@@ -259,4 +319,39 @@ TEST(UnitTestFHEWGINX, EvalDigitDecompSpace) {
         }
     }
 }
+
+TEST(UnitTestFHEWGINX, EvalDigitDecompBatch) {
+    auto cc = BinFHEContext();
+    cc.GenerateBinFHEContext(TOY, false, 29, 0, GINX, false);
+    uint32_t Q = 1 << 29;
+
+    int basic        = 4096;                                       // q
+    int factor       = 1 << int(std::log2(Q) - std::log2(basic));  // Q/q
+    uint64_t p_basic = cc.GetMaxPlaintextSpace().ConvertToInt();
+    uint64_t P       = p_basic * factor;
+    auto st          = P / 2 - 3;
+    auto sk          = cc.KeyGen();
+    cc.BTKeyGen(sk);
+    std::string failed = "Batched Large Precision Ciphertext Decomposition failed";
+
+    std::vector<LWECiphertext> cts;
+    for (uint64_t i = st; i < st + 8; ++i)
+        cts.push_back(cc.Encrypt(sk, i, LARGE_DIM, P, Q));
+    auto decomps = cc.EvalDecomp(cts);
+    ASSERT_EQ(cts.size(), decomps.size()) << failed;
+
+    // the last digit is decrypted modulo p with log p = (log P) mod (log GetMaxPlaintextSpace)
+    auto p_last = uint64_t(1) << (GetMSB(P - 1) % GetMSB(p_basic - 1));
+    for (uint64_t i = st; i < st + 8; ++i) {
+        const auto& decomp = decomps[i - st];
+        EXPECT_EQ(size_t(std::ceil(std::log(factor) / std::log(p_basic)) + 1), decomp.size()) << failed;
+        uint64_t rest = i;
+        for (size_t j = 0; j < decomp.size(); ++j, rest /= p_basic) {
+            auto p_decrypt = (j == decomp.size() - 1) ? p_last : p_basic;
+            LWEPlaintext result;
+            cc.Decrypt(sk, decomp[j], &result, p_decrypt);
+            EXPECT_EQ(LWEPlaintext(rest % p_decrypt), result) << failed;
+        }
+    }
+}
 #endif
@@ -913,6 +913,29 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::ApproxSwitchCRTBasis(
             ans.m_vectors[j][ri] = BarrettUint128ModUint64(sum[j], pj, modpBarrettMu[j]);
         }
     }
+#elif (NATIVEINT == 32) && !defined(WITH_REDUCED_NOISE)
+    // 32-bit limbs: products are accumulated in 64-bit words and reduced once per coefficient
+    uint32_t ringDim = m_params->GetRingDimension();
+    std::vector<uint64_t> sum(sizeP);
+    #pragma omp parallel for firstprivate(sum) num_threads(OpenFHEParallelControls.GetThreadLimit(8))
+    for (uint32_t ri = 0; ri < ringDim; ++ri) {
+        std::fill(sum.begin(), sum.end(), 0);
+        for (uint32_t i = 0; i < sizeQ; ++i) {
+            const auto& QHatModpi    = QHatModp[i];
+            const auto& qi           = m_vectors[i].GetModulus();
+            const auto xQHatInvModqi = m_vectors[i][ri]
+                                           .ModMulFastConst(QHatInvModq[i], qi, QHatInvModqPrecon[i])
+                                           .template ConvertToInt<uint64_t>();
+            for (uint32_t j = 0; j < sizeP; ++j)
+                sum[j] += xQHatInvModqi * QHatModpi[j].ConvertToInt<uint64_t>();
+            if ((i + 1) % LAZY_ACC_TERMS_32 == 0) {
+                for (uint32_t j = 0; j < sizeP; ++j)
+                    sum[j] %= ans.m_vectors[j].GetModulus().template ConvertToInt<uint64_t>();
+            }
+        }
+        for (uint32_t j = 0; j < sizeP; ++j)
+            ans.m_vectors[j][ri] = sum[j] % ans.m_vectors[j].GetModulus().template ConvertToInt<uint64_t>();
+    }
 #else
     for (uint32_t i = 0; i < sizeQ; ++i) {
         auto xQHatInvModqi = m_vectors[i] * QHatInvModq[i];
@@ -1074,6 +1097,15 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::SwitchCRTBasis(const std::shared_pt
             const auto& curNativeValue =
                 NativeInteger(BarrettUint128ModUint64(curValue, pj.ConvertToInt(), modpBarrettMu[j]));
             ans.m_vectors[j][ri] = curNativeValue.ModSubFast(alphaQModpri[j], pj);
+#elif NATIVEINT == 32
+            const auto pjv = pj.template ConvertToInt<uint64_t>();
+            uint64_t curValue{0};
+            for (uint32_t i = 0; i < sizeQ; ++i) {
+                curValue += xQHatInvModq[i].template ConvertToInt<uint64_t>() * QHatModpj[i].ConvertToInt<uint64_t>();
+                if ((i + 1) % LAZY_ACC_TERMS_32 == 0)
+                    curValue %= pjv;
+            }
+            ans.m_vectors[j][ri] = NativeInteger(curValue % pjv).ModSubFast(alphaQModpri[j], pj);
 #else
             for (uint32_t i = 0; i < sizeQ; ++i)
                 ans.m_vectors[j][ri].ModAddFastEq(xQHatInvModq[i].ModMul(QHatModpj[i], pj, mu[j]), pj);
@@ -1206,6 +1238,8 @@ typename DCRTPolyImpl<VecType>::PolyType DCRTPolyImpl<VecType>::ScaleAndRound(
     uint32_t tMSB = t.GetMSB();
     // MSB of sizeQ
     uint32_t sizeQMSB = GetMSB(sizeQ);
+    // the lazy non-power-of-two branches accumulate in a NativeInteger, so their bounds also depend on the word size
+    constexpr uint32_t wordMSB = NativeInteger::MaxBits() - 1;
 
     DCRTPolyImpl::PolyType::Vector coefficients(ringDim, t.ConvertToInt());
     // For power of two t we can do modulo reduction easily
@@ -1337,7 +1371,7 @@ typename DCRTPolyImpl<VecType>::PolyType DCRTPolyImpl<VecType>::ScaleAndRound(
             // error is bounded by 2^{-53}. Thus the floating point error is bounded
             // by sizeQ * q_i/2 * 2^{-53}. In case of qMSB + sizeQMSB < 52 the error
             // is bounded by 1/4, and the rounding will be correct.
-            if ((qMSB + tMSB + sizeQMSB) < 52) {
+            if ((qMSB + tMSB + sizeQMSB) < std::min<uint32_t>(52, wordMSB)) {
                 // No intermediate modulo reductions are needed in this case
                 // we fit in 52 bits, so we can do multiplications and
                 // additions without modulo reduction, and do modulo reduction
@@ -1394,7 +1428,7 @@ typename DCRTPolyImpl<VecType>::PolyType DCRTPolyImpl<VecType>::ScaleAndRound(
         }
         else {
             uint32_t qMSBHf = qMSB >> 1;
-            if ((qMSBHf + tMSB + sizeQMSB) < 52) {
+            if ((qMSBHf + tMSB + sizeQMSB) < std::min<uint32_t>(52, wordMSB)) {
                 // No intermediate modulo reductions are needed in this case
                 // we fit in 52 bits, so we can do multiplications and
                 // additions without modulo reduction, and do modulo reduction
@@ -1496,6 +1530,18 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::ApproxScaleAndRound(
             curValue += Mul128(xi.ConvertToInt(), tPSHatInvModsDivsModpj[sizeQ].ConvertToInt());
 
             ans.m_vectors[j][ri] = BarrettUint128ModUint64(curValue, pj.ConvertToInt(), modpBarretMu[j]);
+#elif NATIVEINT == 32
+            const auto pjv = pj.template ConvertToInt<uint64_t>();
+            uint64_t curValue{0};
+            for (uint32_t i = 0; i < sizeQ; ++i) {
+                curValue += m_vectors[i][ri].template ConvertToInt<uint64_t>() *
+                            tPSHatInvModsDivsModpj[i].template ConvertToInt<uint64_t>();
+                if ((i + 1) % LAZY_ACC_TERMS_32 == 0)
+                    curValue %= pjv;
+            }
+            curValue += m_vectors[sizeQ + j][ri].template ConvertToInt<uint64_t>() *
+                        tPSHatInvModsDivsModpj[sizeQ].template ConvertToInt<uint64_t>();
+            ans.m_vectors[j][ri] = curValue % pjv;
 #else
             for (uint32_t i = 0; i < sizeQ; ++i) {
                 const NativeInteger& xi = m_vectors[i][ri];
@@ -1513,9 +1559,6 @@ template <typename VecType>
 DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::ScaleAndRound(
     const std::shared_ptr<Params>& paramsOutput, const std::vector<std::vector<NativeInteger>>& tOSHatInvModsDivsModo,
     const std::vector<double>& tOSHatInvModsDivsFrac, const std::vector<DoubleNativeInt>& modoBarretMu) const {
-    if constexpr (NATIVEINT == 32)
-        OPENFHE_THROW("Use of ScaleAndRound with NATIVEINT == 32 may lead to overflow");
-
     DCRTPolyImpl<VecType> ans(paramsOutput, m_format, true);
     uint32_t ringDim   = m_params->GetRingDimension();
     uint32_t sizeQP      = m_vectors.size();
@@ -1588,6 +1631,23 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::ScaleAndRound(
                         .ModAddFast(BarrettUint128ModUint64(alpha, oj.ConvertToInt(), modoBarretMu[j]), oj);
             }
         }
+#elif NATIVEINT == 32
+        // with 32-bit limbs nu < (sizeI + 1) * 2^MAX_MODULUS_SIZE, so it always fits in 64 bits
+        auto alpha = static_cast<uint64_t>(nu);
+        for (uint32_t j = 0; j < sizeO; ++j) {
+            const auto& tOSHatInvModsDivsModoj = tOSHatInvModsDivsModo[j];
+            const auto ojv = ans.m_vectors[j].GetModulus().template ConvertToInt<uint64_t>();
+            uint64_t curValue{0};
+            for (uint32_t i = 0; i < sizeI; ++i) {
+                curValue += m_vectors[i + inputIndex][ri].template ConvertToInt<uint64_t>() *
+                            tOSHatInvModsDivsModoj[i].template ConvertToInt<uint64_t>();
+                if ((i + 1) % LAZY_ACC_TERMS_32 == 0)
+                    curValue %= ojv;
+            }
+            curValue += m_vectors[outputIndex + j][ri].template ConvertToInt<uint64_t>() *
+                        tOSHatInvModsDivsModoj[sizeI].template ConvertToInt<uint64_t>();
+            ans.m_vectors[j][ri] = (curValue % ojv + alpha % ojv) % ojv;
+        }
 #else
         if (isConvertableToNativeInt(nu)) {
             NativeInteger alpha = static_cast<BasicInteger>(nu);
@@ -1725,54 +1785,56 @@ void DCRTPolyImpl<VecType>::FastBaseConvqToBskMontgomery(
     for (const auto& q : moduliBsk)
         mu.push_back(q.ComputeMu());
 
-    // first we twist xi by mtilde*(q/qi)^-1 mod qi
-    std::vector<NativeInteger> ximtildeQHatModqi(n * numQ);
-    std::vector<uint64_t> result_mtilde(n, 0);
-    for (uint32_t i = 0; i < numQ; ++i) {
-        const auto& mtildeQHatInvModqi       = mtildeQHatInvModq[i];
-        const auto& mtildeQHatInvModqPreconi = mtildeQHatInvModqPrecon[i];
-        const auto& qHatModmtildei           = QHatModmtilde[i];
-        for (uint32_t k = 0; k < n; ++k) {
-            ximtildeQHatModqi[i * n + k] =
-                m_vectors[i][k].ModMulFastConst(mtildeQHatInvModqi, moduliQ[i], mtildeQHatInvModqPreconi);
-            result_mtilde[k] += ximtildeQHatModqi[i * n + k].ConvertToInt<uint64_t>() * qHatModmtildei;
-        }
-    }
-    for (uint32_t k = 0; k < n; ++k) {
-        result_mtilde[k] &= mtilde_minus_1;
-        result_mtilde[k] *= negQInvModmtilde;
-        result_mtilde[k] &= mtilde_minus_1;
+    // (Q/q_i) mod bsk_j transposed so that row j is contiguous in i
+    std::vector<NativeInteger> QHatModbskT(numBsk * numQ);
+    for (uint32_t j = 0; j < numBsk; ++j) {
+        for (uint32_t i = 0; i < numQ; ++i)
+            QHatModbskT[j * numQ + i] = QHatModbsk[i][j];
     }
 
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numBsk))
-    for (uint32_t j = 0; j < numBsk; ++j) {
-        const auto& moduliBskj             = moduliBsk[j];
-        const auto& mtildeInvModbskj       = mtildeInvModbsk[j];
-        const auto& mtildeInvModbskPreconj = mtildeInvModbskPrecon[j];
-        const auto& qModBskj               = QModbsk[j];
-        const auto& qModBskjPrecon         = QModbskPrecon[j];
-        for (uint32_t k = 0; k < n; ++k) {
+    // The conversion is blocked by coefficient: the numQ residues of a coefficient are twisted by
+    // mtilde*(q/qi)^-1 mod qi into a small coefficient-major scratch buffer and consumed by all Bsk
+    // towers while still in L1, instead of sweeping an n x numQ buffer once per Bsk tower.
+    std::vector<NativeInteger> ximtildeQHatModqi(numQ);
+#pragma omp parallel for firstprivate(ximtildeQHatModqi) num_threads(OpenFHEParallelControls.GetThreadLimit(8))
+    for (uint32_t k = 0; k < n; ++k) {
+        uint64_t result_mtilde = 0;
+        for (uint32_t i = 0; i < numQ; ++i) {
+            ximtildeQHatModqi[i] =
+                m_vectors[i][k].ModMulFastConst(mtildeQHatInvModq[i], moduliQ[i], mtildeQHatInvModqPrecon[i]);
+            result_mtilde += ximtildeQHatModqi[i].ConvertToInt<uint64_t>() * QHatModmtilde[i];
+        }
+        result_mtilde &= mtilde_minus_1;
+        result_mtilde *= negQInvModmtilde;
+        result_mtilde &= mtilde_minus_1;
+
+        for (uint32_t j = 0; j < numBsk; ++j) {
+            const auto& moduliBskj  = moduliBsk[j];
+            const auto* QHatModbskj = &QHatModbskT[j * numQ];
+            auto& xj                = m_vectors[numQ + j][k];
 #if defined(HAVE_INT128) && NATIVEINT == 64
             DoubleNativeInt result = 0;
             for (uint32_t i = 0; i < numQ; ++i)
-                result += Mul128(ximtildeQHatModqi[i * n + k].ConvertToInt<uint64_t>(),
-                                 QHatModbsk[i][j].ConvertToInt<uint64_t>());
-            m_vectors[numQ + j][k] = BarrettUint128ModUint64(result, moduliBskj.ConvertToInt(), modbskBarrettMu[j]);
+                result +=
+                    Mul128(ximtildeQHatModqi[i].ConvertToInt<uint64_t>(), QHatModbskj[i].ConvertToInt<uint64_t>());
+            xj = BarrettUint128ModUint64(result, moduliBskj.ConvertToInt(), modbskBarrettMu[j]);
 #else
             for (uint32_t i = 0; i < numQ; ++i)
-                m_vectors[numQ + j][k].ModAddFastEq(
-                    ximtildeQHatModqi[i * n + k].ModMul(QHatModbsk[i][j], moduliBskj, mu[j]), moduliBskj);
+                xj.ModAddFastEq(ximtildeQHatModqi[i].ModMul(QHatModbskj[i], moduliBskj, mu[j]), moduliBskj);
 #endif
-            NativeInteger r_m_tilde(result_mtilde[k]);  // mtilde = 2^16 < all moduli of Bsk
-            if (result_mtilde[k] >= mtilde_half)
-                r_m_tilde += moduliBskj - mtilde;                               // centred remainder
-            r_m_tilde.ModMulFastConstEq(qModBskj, moduliBskj, qModBskjPrecon);  // (r_mtilde) * q mod Bski
-            r_m_tilde.ModAddFastEq(m_vectors[numQ + j][k], moduliBskj);         // (c``_m + (r_mtilde* q)) mod Bski
-            m_vectors[numQ + j][k] = r_m_tilde.ModMulFastConst(mtildeInvModbskj, moduliBskj, mtildeInvModbskPreconj);
+            NativeInteger r_m_tilde(result_mtilde);  // mtilde = 2^16 < all moduli of Bsk
+            if (result_mtilde >= mtilde_half)
+                r_m_tilde += moduliBskj - mtilde;                                   // centred remainder
+            r_m_tilde.ModMulFastConstEq(QModbsk[j], moduliBskj, QModbskPrecon[j]);  // (r_mtilde) * q mod Bski
+            r_m_tilde.ModAddFastEq(xj, moduliBskj);                                 // (c``_m + (r_mtilde* q)) mod Bski
+            xj = r_m_tilde.ModMulFastConst(mtildeInvModbsk[j], moduliBskj, mtildeInvModbskPrecon[j]);
         }
-        m_vectors[numQ + j].SetFormat(Format::EVALUATION);
     }
 
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numBsk))
+    for (uint32_t j = 0; j < numBsk; ++j)
+        m_vectors[numQ + j].SetFormat(Format::EVALUATION);
+
     m_format = Format::EVALUATION;
     if (polyInNTT.size() > 0) {
         // if input polynomial was in evaluation representation, use towers for Q from it
@@ -1803,38 +1865,40 @@ void DCRTPolyImpl<VecType>::FastRNSFloorq(
     for (const auto& q : moduliBsk)
         mu.push_back(q.ComputeMu());
 
-    // Twist xi by t*(q/qi)^-1 mod qi
-    for (uint32_t i = 0; i < numQ; ++i) {
-        const auto& tqDivqiModqi       = tQHatInvModq[i];
-        const auto& tqDivqiModqiPrecon = tQHatInvModqPrecon[i];
-        const auto& moduliQi           = moduliQ[i];
-        for (uint32_t k = 0; k < n; ++k)
-            m_vectors[i][k].ModMulFastConstEq(tqDivqiModqi, moduliQi, tqDivqiModqiPrecon);
+    // q_i^{-1} mod bsk_j transposed so that row j is contiguous in i
+    std::vector<NativeInteger> qInvModbskT(numBsk * numQ);
+    for (uint32_t j = 0; j < numBsk; ++j) {
+        for (uint32_t i = 0; i < numQ; ++i)
+            qInvModbskT[j * numQ + i] = qInvModbsk[i][j];
     }
 
-    std::vector<NativeInteger> txiqiDivqModqi(n * numBsk);
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numBsk))
-    for (uint32_t j = 0; j < numBsk; ++j) {
-        const auto& moduliBskj         = moduliBsk[j];
-        const auto& tDivqModBskj       = tQInvModbsk[j];
-        const auto& tDivqModBskjPrecon = tQInvModbskPrecon[j];
-        for (uint32_t k = 0; k < n; ++k) {
+    // blocked by coefficient: the twisted residues of a coefficient are reused by all Bsk towers while in L1
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(8))
+    for (uint32_t k = 0; k < n; ++k) {
+        // Twist xi by t*(q/qi)^-1 mod qi
+        for (uint32_t i = 0; i < numQ; ++i)
+            m_vectors[i][k].ModMulFastConstEq(tQHatInvModq[i], moduliQ[i], tQHatInvModqPrecon[i]);
+
+        for (uint32_t j = 0; j < numBsk; ++j) {
+            const auto& moduliBskj  = moduliBsk[j];
+            const auto* qInvModbskj = &qInvModbskT[j * numQ];
 #if defined(HAVE_INT128) && NATIVEINT == 64
             DoubleNativeInt aq = 0;
             for (uint32_t i = 0; i < numQ; ++i) {
                 const auto& xi = m_vectors[i][k];
-                aq += Mul128(xi.template ConvertToInt<uint64_t>(), qInvModbsk[i][j].ConvertToInt<uint64_t>());
+                aq += Mul128(xi.template ConvertToInt<uint64_t>(), qInvModbskj[i].ConvertToInt<uint64_t>());
             }
-            txiqiDivqModqi[j * n + k] = BarrettUint128ModUint64(aq, moduliBskj.ConvertToInt(), modbskBarrettMu[j]);
+            NativeInteger txiqiDivqModqi = BarrettUint128ModUint64(aq, moduliBskj.ConvertToInt(), modbskBarrettMu[j]);
 #else
+            NativeInteger txiqiDivqModqi = 0;
             for (uint32_t i = 0; i < numQ; ++i) {
                 const auto& xi = m_vectors[i][k];
-                txiqiDivqModqi[j * n + k].ModAddFastEq(xi.ModMul(qInvModbsk[i][j], moduliBskj, mu[j]), moduliBskj);
+                txiqiDivqModqi.ModAddFastEq(xi.ModMul(qInvModbskj[i], moduliBskj, mu[j]), moduliBskj);
             }
 #endif
             // now we have FastBaseConv( |t*ct|q, q, Bsk ) in txiqiDivqModqi
-            m_vectors[numQ + j][k].ModMulFastConstEq(tDivqModBskj, moduliBskj, tDivqModBskjPrecon);
-            m_vectors[numQ + j][k].ModSubFastEq(txiqiDivqModqi[j * n + k], moduliBskj);
+            m_vectors[numQ + j][k].ModMulFastConstEq(tQInvModbsk[j], moduliBskj, tQInvModbskPrecon[j]);
+            m_vectors[numQ + j][k].ModSubFastEq(txiqiDivqModqi, moduliBskj);
         }
     }
 }
@@ -1866,53 +1930,53 @@ void DCRTPolyImpl<VecType>::FastBaseConvSK(
     uint32_t sizeBskm1(sizeBsk - 1);
     uint32_t n(m_params->GetRingDimension());
 
-    std::vector<NativeInteger> alphaskxVector(n, 0);
     [[maybe_unused]] NativeInteger muBsk(moduliBsk[sizeBskm1].ComputeMu());
-    NativeInteger mskDivTwo(moduliBsk[sizeBskm1] >> 1);
-
-    for (uint32_t i = 0; i < sizeBskm1; i++) {  // exclude msk residue
-        const auto& moduliBski        = moduliBsk[i];
-        const auto& bHatModmski       = BHatModmsk[i];
-        const auto& bDivBiModBi       = BHatInvModb[i];
-        const auto& bDivBiModBiPrecon = BHatInvModbPrecon[i];
-        for (uint32_t k = 0; k < n; ++k) {
-            m_vectors[sizeQ + i][k].ModMulFastConstEq(bDivBiModBi, moduliBski, bDivBiModBiPrecon);
-            alphaskxVector[k].ModAddEq(m_vectors[sizeQ + i][k].ModMul(bHatModmski, moduliBsk[sizeBskm1], muBsk),
-                                       moduliBsk[sizeBskm1]);
-        }
+    const auto& msk = moduliBsk[sizeBskm1];
+    NativeInteger mskDivTwo(msk >> 1);
+
+    // (B/b_i) mod q_j transposed so that row j is contiguous in i
+    std::vector<NativeInteger> BHatModqT(sizeQ * sizeBskm1);
+    for (uint32_t j = 0; j < sizeQ; ++j) {
+        for (uint32_t i = 0; i < sizeBskm1; ++i)
+            BHatModqT[j * sizeBskm1 + i] = BHatModq[i][j];
     }
+
+    // blocked by coefficient: the twisted Bsk residues of a coefficient are reused by all q towers while in L1
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(8))
     for (uint32_t k = 0; k < n; ++k) {
-        alphaskxVector[k] = alphaskxVector[k].ModSubFast(m_vectors[sizeQ + sizeBskm1][k], moduliBsk[sizeBskm1]);
-        alphaskxVector[k].ModMulFastConstEq(BInvModmsk, moduliBsk[sizeBskm1], BInvModmskPrecon);
-    }
+        NativeInteger alphaskx(0);
+        for (uint32_t i = 0; i < sizeBskm1; ++i) {  // exclude msk residue
+            auto& xi = m_vectors[sizeQ + i][k];
+            xi.ModMulFastConstEq(BHatInvModb[i], moduliBsk[i], BHatInvModbPrecon[i]);
+            alphaskx.ModAddEq(xi.ModMul(BHatModmsk[i], msk, muBsk), msk);
+        }
+        alphaskx = alphaskx.ModSubFast(m_vectors[sizeQ + sizeBskm1][k], msk);
+        alphaskx.ModMulFastConstEq(BInvModmsk, msk, BInvModmskPrecon);
 
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(sizeQ))
-    for (uint32_t j = 0; j < sizeQ; ++j) {
-        const auto& moduliQj     = moduliQ[j];
-        const auto& bModqj       = BModq[j];
-        const auto& bModqjPrecon = BModqPrecon[j];
-        for (uint32_t k = 0; k < n; ++k) {
+        for (uint32_t j = 0; j < sizeQ; ++j) {
+            const auto& moduliQj  = moduliQ[j];
+            const auto* BHatModqj = &BHatModqT[j * sizeBskm1];
 #if defined(HAVE_INT128) && NATIVEINT == 64
             DoubleNativeInt result = 0;
             for (uint32_t i = 0; i < sizeBskm1; ++i) {  // exclude msk residue
                 const auto& xi = m_vectors[sizeQ + i][k];
-                result += Mul128(xi.template ConvertToInt<uint64_t>(), BHatModq[i][j].ConvertToInt<uint64_t>());
+                result += Mul128(xi.template ConvertToInt<uint64_t>(), BHatModqj[i].ConvertToInt<uint64_t>());
             }
             m_vectors[j][k] = BarrettUint128ModUint64(result, moduliQj.ConvertToInt(), modqBarrettMu[j]);
 #else
             NativeInteger result(0);
             for (uint32_t i = 0; i < sizeBskm1; ++i) {  // exclude msk residue
                 const auto& xi = m_vectors[sizeQ + i][k];
-                result.ModAddFastEq(xi.ModMul(BHatModq[i][j], moduliQj, mu[j]), moduliQ[j]);
+                result.ModAddFastEq(xi.ModMul(BHatModqj[i], moduliQj, mu[j]), moduliQj);
             }
             m_vectors[j][k] = result;
 #endif
             // do (m_vector - alphaskx*M) mod q
-            NativeInteger alphaskBModqj = alphaskxVector[k];
+            NativeInteger alphaskBModqj = alphaskx;
             if (alphaskBModqj > mskDivTwo)
-                alphaskBModqj = alphaskBModqj.ModSubFast(moduliBsk[sizeBskm1], moduliQ[j]);
-            alphaskBModqj.ModMulFastConstEq(bModqj, moduliQ[j], bModqjPrecon);
-            m_vectors[j][k] = m_vectors[j][k].ModSubFast(alphaskBModqj, moduliQ[j]);
+                alphaskBModqj = alphaskBModqj.ModSubFast(msk, moduliQj);
+            alphaskBModqj.ModMulFastConstEq(BModq[j], moduliQj, BModqPrecon[j]);
+            m_vectors[j][k] = m_vectors[j][k].ModSubFast(alphaskBModqj, moduliQj);
         }
     }
 
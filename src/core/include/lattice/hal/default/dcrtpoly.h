@@ -46,6 +46,7 @@
 #include "utils/exception.h"
 #include "utils/inttypes.h"
 #include "utils/parallel.h"
+#include "utils/profiler.h"
 
 #include <functional>
 #include <memory>
@@ -73,11 +74,14 @@ public:
 
     DCRTPolyImpl() = default;
 
-    DCRTPolyImpl(const DCRTPolyType& e) noexcept : m_params{e.m_params}, m_format{e.m_format}, m_vectors{e.m_vectors} {}
+    DCRTPolyImpl(const DCRTPolyType& e) noexcept : m_params{e.m_params}, m_format{e.m_format}, m_vectors{e.m_vectors} {
+        CountAllocation();
+    }
     DCRTPolyType& operator=(const DCRTPolyType& rhs) noexcept override {
         m_params  = rhs.m_params;
         m_format  = rhs.m_format;
         m_vectors = rhs.m_vectors;
+        CountAllocation();
         return *this;
     }
 
@@ -104,6 +108,7 @@ public:
         m_vectors.reserve(m_params->GetParams().size());
         for (const auto& p : m_params->GetParams())
             m_vectors.emplace_back(p, m_format, initializeElementToZero);
+        CountAllocation();
     }
 
     DCRTPolyImpl(const DggType& dgg, const std::shared_ptr<Params>& p, Format f = Format::EVALUATION);
@@ -392,6 +397,12 @@ public:
     }
 
 protected:
+    // reports the tower storage of a newly allocated or copied element to the performance counters
+    void CountAllocation() const noexcept {
+        if (PerfCounters::IsEnabled() && m_params)
+            PerfCounters::CountBytes(m_vectors.size() * m_params->GetRingDimension() * sizeof(NativeInteger));
+    }
+
     std::shared_ptr<Params> m_params{std::make_shared<DCRTPolyImpl::Params>()};
     Format m_format{Format::EVALUATION};
     std::vector<PolyType> m_vectors;
@@ -40,8 +40,11 @@
 #include "math/binaryuniformgenerator.h"
 
 #include "utils/inttypes.h"
+#include "utils/memory.h"
 
+#include <limits>
 #include <random>
+#include <vector>
 
 namespace lbcrypto {
 
@@ -56,9 +59,16 @@ typename VecType::Integer BinaryUniformGeneratorImpl<VecType>::GenerateInteger()
 template <typename VecType>
 VecType BinaryUniformGeneratorImpl<VecType>::GenerateVector(const usint size,
                                                             const typename VecType::Integer& modulus) const {
+    // every PRNG sample provides 32 bits
+    constexpr uint32_t bitsPerSample = std::numeric_limits<PRNG::result_type>::digits;
+    std::vector<PRNG::result_type> block((size + bitsPerSample - 1) / bitsPerSample);
+    PseudoRandomNumberGenerator::Fill(block.data(), block.size());
+
     VecType v(size, modulus);
     for (usint i = 0; i < size; i++)
-        v[i] = GenerateInteger();
+        v[i] = typename VecType::Integer((block[i / bitsPerSample] >> (i % bitsPerSample)) & 0x1);
+    // IMPORTANT: clear the PRNG samples for security reasons
+    secure_memset(block.data(), 0, block.size() * sizeof(block[0]));
     return v;
 }
 
@@ -39,6 +39,7 @@
 
 #include "math/discretegaussiangenerator.h"
 #include "utils/exception.h"
+#include "utils/memory.h"
 
 #include <algorithm>
 #include <cmath>
@@ -106,11 +107,44 @@ int64_t DiscreteGaussianGeneratorImpl<VecType>::GenerateInt() const {
     return (tmp <= 0.0) ? 0 : FindInVector(m_vals, tmp) * (seed > 0.0 ? 1 : -1);
 }
 
+template <typename VecType>
+void DiscreteGaussianGeneratorImpl<VecType>::GenerateIntsPeikert(int64_t* out, uint32_t size) const {
+    std::vector<PRNG::result_type> block(2 * DGG_BLOCK_SIZE);
+    for (uint32_t i = 0; i < size; i += DGG_BLOCK_SIZE) {
+        const uint32_t n = std::min(DGG_BLOCK_SIZE, size - i);
+        PseudoRandomNumberGenerator::Fill(block.data(), 2 * n);
+        for (uint32_t j = 0; j < n; ++j) {
+            // two PRNG samples give a double in [0, 1) as in std::uniform_real_distribution<double>
+            double u = (block[2 * j] + block[2 * j + 1] * 4294967296.0) * 0x1p-64;
+            if (u >= 1.0)
+                u = std::nextafter(1.0, 0.0);
+            double seed = u - 0.5;
+            double tmp  = std::abs(seed) - m_a / 2;
+
+            // the whole table is scanned so that the time does not depend on the sample; the number of entries
+            // below tmp is the position std::lower_bound would find
+            int64_t below = 0;
+            for (double val : m_vals)
+                below += (val < tmp);
+            if (below == static_cast<int64_t>(m_vals.size()))
+                OPENFHE_THROW("DGG Inversion Sampling. FindInVector value not found: " + std::to_string(tmp));
+
+            out[i + j] = (tmp > 0.0) * (below + 1) * (seed > 0.0 ? 1 : -1);
+        }
+    }
+    // IMPORTANT: clear the PRNG samples for security reasons
+    secure_memset(block.data(), 0, block.size() * sizeof(block[0]));
+}
+
 template <typename VecType>
 std::vector<int64_t> DiscreteGaussianGeneratorImpl<VecType>::GenerateIntVector(uint32_t size) const {
     std::vector<int64_t> ans(size);
+    if (m_peikert) {
+        GenerateIntsPeikert(ans.data(), size);
+        return ans;
+    }
     for (uint32_t i = 0; i < size; ++i)
-        ans[i] = m_peikert ? GenerateInt() : GenerateIntegerKarney(0, m_std);
+        ans[i] = GenerateIntegerKarney(0, m_std);
     return ans;
 }
 
@@ -124,11 +158,11 @@ typename VecType::Integer DiscreteGaussianGeneratorImpl<VecType>::GenerateIntege
 template <typename VecType>
 VecType DiscreteGaussianGeneratorImpl<VecType>::GenerateVector(uint32_t size,
                                                                const typename VecType::Integer& modulus) const {
+    auto vals = GenerateIntVector(size);
     VecType ans(size, modulus);
-    for (uint32_t i = 0; i < size; ++i) {
-        auto val = m_peikert ? GenerateInt() : GenerateIntegerKarney(0, m_std);
-        ans[i]   = (val < 0) ? modulus - typename VecType::Integer(-val) : typename VecType::Integer(val);
-    }
+    for (uint32_t i = 0; i < size; ++i)
+        ans[i] = (vals[i] < 0) ? modulus - typename VecType::Integer(-vals[i]) : typename VecType::Integer(vals[i]);
+    secure_memset(vals.data(), 0, vals.size() * sizeof(vals[0]));
     return ans;
 }
 
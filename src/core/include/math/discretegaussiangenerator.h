@@ -77,6 +77,8 @@
 namespace lbcrypto {
 
 constexpr double KARNEY_THRESHOLD = 300.0;
+// number of values generated per block of PRNG samples by Peikert's inversion method
+constexpr uint32_t DGG_BLOCK_SIZE = 256;
 
 /**
  * @brief The class for Discrete Gaussion Distribution generator.
@@ -198,6 +200,10 @@ private:
 
     static int64_t FindInVector(const std::vector<double>& S, double search);
 
+    // Peikert's inversion method for a whole vector: the PRNG samples are drawn in blocks and the table is scanned
+    // in constant time
+    void GenerateIntsPeikert(int64_t* out, uint32_t size) const;
+
     static double UnnormalizedGaussianPDF(const double& mean, const double& sigma, int32_t x) {
         return std::pow(M_E, -std::pow(x - mean, 2) / (2. * sigma * sigma));
     }
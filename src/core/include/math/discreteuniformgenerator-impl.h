@@ -40,6 +40,9 @@
 #include "math/discreteuniformgenerator.h"
 #include "math/distributiongenerator.h"
 #include "utils/exception.h"
+#include "utils/memory.h"
+
+#include <vector>
 
 namespace lbcrypto {
 
@@ -81,9 +84,37 @@ typename VecType::Integer DiscreteUniformGeneratorImpl<VecType>::GenerateInteger
 
 template <typename VecType>
 VecType DiscreteUniformGeneratorImpl<VecType>::GenerateVector(const uint32_t size) const {
+    if (m_modulus == typename VecType::Integer(0))
+        OPENFHE_THROW("0 modulus?");
+
+    // Each candidate is built from m_chunksPerValue + 1 PRNG samples, with the last one masked to the remaining bits of
+    // the modulus, and is rejected if it is not below the modulus. At least half of the candidates are accepted.
+    // The PRNG samples are drawn in blocks rather than one by one.
+    const uint32_t words   = m_chunksPerValue + 1;
+    const uint32_t topBits = m_modulus.GetMSB() - m_shiftChunk;
+    const PRNG::result_type topMask =
+        (topBits >= DUG_CHUNK_WIDTH) ? DUG_CHUNK_MAX : (PRNG::result_type(1) << topBits) - 1;
+
+    std::vector<PRNG::result_type> block(words * DUG_BLOCK_CANDIDATES);
+    size_t pos = block.size();
+
     VecType v(size, m_modulus);
-    for (uint32_t i = 0; i < size; ++i)
-        v[i] = this->GenerateInteger();
+    for (uint32_t i = 0; i < size;) {
+        if (pos == block.size()) {
+            PseudoRandomNumberGenerator::Fill(block.data(), block.size());
+            pos = 0;
+        }
+        auto result = typename VecType::Integer{block[pos + m_chunksPerValue] & topMask} << m_shiftChunk;
+        for (uint32_t j{0}, shift{0}; j < m_chunksPerValue; ++j, shift += DUG_CHUNK_WIDTH)
+            result += typename VecType::Integer{block[pos + j]} << shift;
+        pos += words;
+
+        if (result < m_modulus)
+            v[i++] = result;
+    }
+
+    // IMPORTANT: clear the unused PRNG samples for security reasons
+    secure_memset(block.data(), 0, block.size() * sizeof(block[0]));
     return v;
 }
 
@@ -91,10 +122,7 @@ template <typename VecType>
 VecType DiscreteUniformGeneratorImpl<VecType>::GenerateVector(const uint32_t size,
                                                               const typename VecType::Integer& modulus) {
     this->SetModulus(modulus);
-    VecType v(size, m_modulus);
-    for (uint32_t i = 0; i < size; ++i)
-        v[i] = this->GenerateInteger();
-    return v;
+    return static_cast<const DiscreteUniformGeneratorImpl<VecType>&>(*this).GenerateVector(size);
 }
 
 }  // namespace lbcrypto
@@ -47,6 +47,8 @@ namespace lbcrypto {
 constexpr uint32_t DUG_CHUNK_MIN{0};
 constexpr uint32_t DUG_CHUNK_WIDTH{std::numeric_limits<uint32_t>::digits};
 constexpr uint32_t DUG_CHUNK_MAX{std::numeric_limits<uint32_t>::max()};
+// number of candidate values drawn from the PRNG at once by GenerateVector()
+constexpr uint32_t DUG_BLOCK_CANDIDATES{256};
 
 /**
  * @brief The class for Discrete Uniform Distribution generator over Zq.
@@ -71,7 +73,7 @@ public:
     typename VecType::Integer GenerateInteger() const;
 
     /**
-   * @brief Generates a vector of random integers using GenerateInteger()
+   * @brief Generates a vector of random integers. Uses rejection sampling on blocks of PRNG samples
    */
     VecType GenerateVector(const uint32_t size) const;
     VecType GenerateVector(const uint32_t size, const typename VecType::Integer& modulus);
@@ -40,6 +40,7 @@
 #include "utils/prng/prng.h"
 #include "config_core.h"
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -67,6 +68,12 @@ public:
      */
     static PRNG& GetPRNG();
 
+    /**
+     * @brief Fills out with the next count samples of the PRNG engine of the calling thread. The built-in engine
+     *        copies whole blocks of its buffer; an external engine is called once per sample.
+     */
+    static void Fill(PRNG::result_type* out, size_t count);
+
 private:
     using GenPRNGEngineFuncPtr = PRNG* (*)();
 
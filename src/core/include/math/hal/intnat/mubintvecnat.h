@@ -503,6 +503,42 @@ public:
         return *this;
     }
 
+    /**
+   * Converts all entries to Montgomery form (x*R mod q, R = 2^MaxBits()). The
+   * modulus has to be odd; see NativeIntegerT::ComputeMontgomeryInverse.
+   *
+   * @return the vector in Montgomery form.
+   */
+    NativeVectorT& ToMontgomeryEq();
+
+    /**
+   * Converts all entries from Montgomery form back to standard form.
+   *
+   * @return the vector in standard form.
+   */
+    NativeVectorT& FromMontgomeryEq();
+
+    /**
+   * Vector Montgomery multiplication: this[i] = this[i]*b[i]*R^{-1} mod q.
+   * Keeps the Montgomery form if both operands are in Montgomery form.
+   *
+   * @param &b is the vector to multiply.
+   * @return is the result of the modulus multiplication operation.
+   */
+    NativeVectorT& ModMulMontgomeryEq(const NativeVectorT& b);
+
+    /**
+   * Fused Montgomery multiply-accumulate: this[i] = this[i] + a[i]*b[i]*R^{-1} mod q.
+   * Inner products of standard-form vectors can be accumulated with this call
+   * and the common R^{-1} factor removed once at the end with ToMontgomeryEq(),
+   * which replaces one Barrett reduction per term by a single REDC.
+   *
+   * @param &a is the first vector to multiply.
+   * @param &b is the second vector to multiply.
+   * @return is the result of the multiply-accumulate operation.
+   */
+    NativeVectorT& ModMulAddMontgomeryEq(const NativeVectorT& a, const NativeVectorT& b);
+
     /**
    * Vector multiplication without applying the modulus operation.
    *
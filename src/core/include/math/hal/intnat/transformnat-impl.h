@@ -44,8 +44,10 @@
 
 #include "utils/exception.h"
 #include "utils/inttypes.h"
+#include "utils/profiler.h"
 #include "utils/utilities.h"
 
+#include <algorithm>
 #include <map>
 #include <utility>
 #include <vector>
@@ -299,6 +301,45 @@ void NumberTheoreticTransformNat<VecType>::ForwardTransformToBitReverse(const Ve
     return;
 }
 
+template <typename VecType>
+inline void NumberTheoreticTransformNat<VecType>::ButterflyCT(IntType& loVal, IntType& hiVal, const IntType& omega,
+                                                              const IntType& preconOmega, const IntType& modulus) {
+    auto omegaFactor{hiVal};
+    omegaFactor.ModMulFastConstEq(omega, modulus, preconOmega);
+#if defined(__GNUC__) && !defined(__clang__)
+    auto sum{loVal + omegaFactor};
+    if (sum >= modulus)
+        sum -= modulus;
+    if (loVal < omegaFactor)
+        loVal += modulus;
+    hiVal = loVal - omegaFactor;
+    loVal = sum;
+#else
+    // fixes Clang slowdown issue, but requires lowVal be less than modulus
+    hiVal = loVal + (omegaFactor > loVal ? modulus : 0) - omegaFactor;
+    loVal += omegaFactor - (omegaFactor >= (modulus - loVal) ? modulus : 0);
+#endif
+}
+
+template <typename VecType>
+inline void NumberTheoreticTransformNat<VecType>::ButterflyGS(IntType& loVal, IntType& hiVal, const IntType& omega,
+                                                              const IntType& preconOmega, const IntType& modulus) {
+#if defined(__GNUC__) && !defined(__clang__)
+    auto omegaFactor{loVal};
+    if (omegaFactor < hiVal)
+        omegaFactor += modulus;
+    omegaFactor -= hiVal;
+    loVal += hiVal;
+    if (loVal >= modulus)
+        loVal -= modulus;
+#else
+    auto omegaFactor{loVal + (hiVal > loVal ? modulus : 0) - hiVal};
+    loVal += hiVal - (hiVal >= (modulus - loVal) ? modulus : 0);
+#endif
+    omegaFactor.ModMulFastConstEq(omega, modulus, preconOmega);
+    hiVal = omegaFactor;
+}
+
 template <typename VecType>
 void NumberTheoreticTransformNat<VecType>::ForwardTransformToBitReverseInPlace(const VecType& rootOfUnityTable,
                                                                                const VecType& preconRootOfUnityTable,
@@ -318,58 +359,73 @@ void NumberTheoreticTransformNat<VecType>::ForwardTransformToBitReverseInPlace(c
     //             element[j1 + 0] = (loVal + hiVal) mod modulus
     //             element[j1 + t] = (loVal - hiVal) mod modulus
     //
+    // The stages are evaluated cache-blocked: stages whose butterflies span more than
+    // NTT_BLOCK_LENGTH elements sweep the whole vector two stages at a time (radix-4),
+    // and the remaining stages run to completion on one block before moving to the next,
+    // so a block and its twiddle factors stay resident in cache.
+    //
 
     const auto modulus{element->GetModulus()};
-    const uint32_t n(element->GetLength() >> 1);
-    for (uint32_t m{1}, t{n}, logt{GetMSB(t)}; m < n; m <<= 1, t >>= 1, --logt) {
-        for (uint32_t i{0}; i < m; ++i) {
-            auto omega{rootOfUnityTable[i + m]};
-            auto preconOmega{preconRootOfUnityTable[i + m]};
-            for (uint32_t j1{i << logt}, j2{j1 + t}; j1 < j2; ++j1) {
-                auto omegaFactor{(*element)[j1 + t]};
-                omegaFactor.ModMulFastConstEq(omega, modulus, preconOmega);
-                auto loVal{(*element)[j1 + 0]};
-#if defined(__GNUC__) && !defined(__clang__)
-                auto hiVal{loVal + omegaFactor};
-                if (hiVal >= modulus)
-                    hiVal -= modulus;
-                if (loVal < omegaFactor)
-                    loVal += modulus;
-                loVal -= omegaFactor;
-                (*element)[j1 + 0] = hiVal;
-                (*element)[j1 + t] = loVal;
-#else
-                // fixes Clang slowdown issue, but requires lowVal be less than modulus
-                (*element)[j1 + 0] += omegaFactor - (omegaFactor >= (modulus - loVal) ? modulus : 0);
-                if (omegaFactor > loVal)
-                    loVal += modulus;
-                (*element)[j1 + t] = loVal - omegaFactor;
-#endif
+    const uint32_t size(element->GetLength());
+    const uint32_t n(size >> 1);
+    const uint32_t blockLength{std::min(size, NTT_BLOCK_LENGTH)};
+
+    uint32_t m{1}, t{n};
+    while (t >= blockLength) {
+        if (t >= (blockLength << 1)) {
+            const uint32_t t2{t >> 1};
+            for (uint32_t i{0}; i < m; ++i) {
+                const auto& omega{rootOfUnityTable[i + m]};
+                const auto& preconOmega{preconRootOfUnityTable[i + m]};
+                const auto& omegaLo{rootOfUnityTable[((i + m) << 1) + 0]};
+                const auto& preconOmegaLo{preconRootOfUnityTable[((i + m) << 1) + 0]};
+                const auto& omegaHi{rootOfUnityTable[((i + m) << 1) + 1]};
+                const auto& preconOmegaHi{preconRootOfUnityTable[((i + m) << 1) + 1]};
+                for (uint32_t j1{i * (t << 1)}, j2{j1 + t2}; j1 < j2; ++j1) {
+                    auto x0{(*element)[j1 + 0]};
+                    auto x1{(*element)[j1 + t2]};
+                    auto x2{(*element)[j1 + t]};
+                    auto x3{(*element)[j1 + t + t2]};
+                    ButterflyCT(x0, x2, omega, preconOmega, modulus);
+                    ButterflyCT(x1, x3, omega, preconOmega, modulus);
+                    ButterflyCT(x0, x1, omegaLo, preconOmegaLo, modulus);
+                    ButterflyCT(x2, x3, omegaHi, preconOmegaHi, modulus);
+                    (*element)[j1 + 0]      = x0;
+                    (*element)[j1 + t2]     = x1;
+                    (*element)[j1 + t]      = x2;
+                    (*element)[j1 + t + t2] = x3;
+                }
             }
+            m <<= 2;
+            t >>= 2;
+        }
+        else {
+            for (uint32_t i{0}; i < m; ++i) {
+                const auto& omega{rootOfUnityTable[i + m]};
+                const auto& preconOmega{preconRootOfUnityTable[i + m]};
+                for (uint32_t j1{i * (t << 1)}, j2{j1 + t}; j1 < j2; ++j1)
+                    ButterflyCT((*element)[j1 + 0], (*element)[j1 + t], omega, preconOmega, modulus);
+            }
+            m <<= 1;
+            t >>= 1;
         }
     }
-    // peeled off last ntt stage for performance
-    for (uint32_t i{0}; i < (n << 1); i += 2) {
-        auto omegaFactor{(*element)[i + 1]};
-        auto omega{rootOfUnityTable[(i >> 1) + n]};
-        auto preconOmega{preconRootOfUnityTable[(i >> 1) + n]};
-        omegaFactor.ModMulFastConstEq(omega, modulus, preconOmega);
-        auto loVal{(*element)[i + 0]};
-#if defined(__GNUC__) && !defined(__clang__)
-        auto hiVal{loVal + omegaFactor};
-        if (hiVal >= modulus)
-            hiVal -= modulus;
-        if (loVal < omegaFactor)
-            loVal += modulus;
-        loVal -= omegaFactor;
-        (*element)[i + 0] = hiVal;
-        (*element)[i + 1] = loVal;
-#else
-        (*element)[i + 0] += omegaFactor - (omegaFactor >= (modulus - loVal) ? modulus : 0);
-        if (omegaFactor > loVal)
-            loVal += modulus;
-        (*element)[i + 1] = loVal - omegaFactor;
-#endif
+
+    for (uint32_t b{0}; b < size; b += blockLength) {
+        for (uint32_t mb{m}, tb{t}, logt{GetMSB(tb)}; tb > 1; mb <<= 1, tb >>= 1, --logt) {
+            for (uint32_t i{b >> logt}, iEnd{(b + blockLength) >> logt}; i < iEnd; ++i) {
+                const auto& omega{rootOfUnityTable[i + mb]};
+                const auto& preconOmega{preconRootOfUnityTable[i + mb]};
+                for (uint32_t j1{i << logt}, j2{j1 + tb}; j1 < j2; ++j1)
+                    ButterflyCT((*element)[j1 + 0], (*element)[j1 + tb], omega, preconOmega, modulus);
+            }
+        }
+        // peeled off last ntt stage for performance
+        for (uint32_t i{b}, iEnd{b + blockLength}; i < iEnd; i += 2) {
+            const auto& omega{rootOfUnityTable[(i >> 1) + n]};
+            const auto& preconOmega{preconRootOfUnityTable[(i >> 1) + n]};
+            ButterflyCT((*element)[i + 0], (*element)[i + 1], omega, preconOmega, modulus);
+        }
     }
 }
 
@@ -530,67 +586,79 @@ void NumberTheoreticTransformNat<VecType>::InverseTransformFromBitReverseInPlace
     // for (i = 0; i < n; ++i) do
     //     element[i] = element[i]*cycloOrderInv mod modulus
     //
+    // The stages are evaluated in the reverse order of the blocking used by the forward
+    // transform: first every stage that fits in NTT_BLOCK_LENGTH elements, block by block,
+    // then the wider stages as radix-4 sweeps over the whole vector.
+    //
 
     auto modulus{element->GetModulus()};
     uint32_t n(element->GetLength());
+    const uint32_t blockLength{std::min(n, NTT_BLOCK_LENGTH)};
+    const uint32_t tLocal{std::min(blockLength, n >> 1)};
 
     // precomputed omega[bitreversed(1)] * (n inverse). used in final stage of intt.
     auto omega1Inv{rootOfUnityInverseTable[1].ModMulFastConst(cycloOrderInv, modulus, preconCycloOrderInv)};
     auto preconOmega1Inv{omega1Inv.PrepModMulConst(modulus)};
 
-    if (n > 2) {
-        // peeled off first stage for performance
-        for (uint32_t i{0}; i < n; i += 2) {
-            auto omega{rootOfUnityInverseTable[(i + n) >> 1]};
-            auto preconOmega{preconRootOfUnityInverseTable[(i + n) >> 1]};
-            auto loVal{(*element)[i + 0]};
-            auto hiVal{(*element)[i + 1]};
-#if defined(__GNUC__) && !defined(__clang__)
-            auto omegaFactor{loVal};
-            if (omegaFactor < hiVal)
-                omegaFactor += modulus;
-            omegaFactor -= hiVal;
-            loVal += hiVal;
-            if (loVal >= modulus)
-                loVal -= modulus;
-            omegaFactor.ModMulFastConstEq(omega, modulus, preconOmega);
-            (*element)[i + 0] = loVal;
-            (*element)[i + 1] = omegaFactor;
-#else
-            auto omegaFactor{loVal + (hiVal > loVal ? modulus : 0) - hiVal};
-            loVal += hiVal - (hiVal >= (modulus - loVal) ? modulus : 0);
-            (*element)[i + 0] = loVal;
-            omegaFactor.ModMulFastConstEq(omega, modulus, preconOmega);
-            (*element)[i + 1] = omegaFactor;
-#endif
+    for (uint32_t b{0}; b < n; b += blockLength) {
+        if (n > 2) {
+            // peeled off first stage for performance
+            for (uint32_t i{b}, iEnd{b + blockLength}; i < iEnd; i += 2) {
+                const auto& omega{rootOfUnityInverseTable[(i + n) >> 1]};
+                const auto& preconOmega{preconRootOfUnityInverseTable[(i + n) >> 1]};
+                ButterflyGS((*element)[i + 0], (*element)[i + 1], omega, preconOmega, modulus);
+            }
+        }
+        // inner stages local to the block
+        for (uint32_t m{n >> 2}, t{2}, logt{2}; t < tLocal; m >>= 1, t <<= 1, ++logt) {
+            for (uint32_t i{b >> logt}, iEnd{(b + blockLength) >> logt}; i < iEnd; ++i) {
+                const auto& omega{rootOfUnityInverseTable[i + m]};
+                const auto& preconOmega{preconRootOfUnityInverseTable[i + m]};
+                for (uint32_t j1{i << logt}, j2{j1 + t}; j1 < j2; ++j1)
+                    ButterflyGS((*element)[j1 + 0], (*element)[j1 + t], omega, preconOmega, modulus);
+            }
         }
     }
-    // inner stages
-    for (uint32_t m{n >> 2}, t{2}, logt{2}; m > 1; m >>= 1, t <<= 1, ++logt) {
-        for (uint32_t i{0}; i < m; ++i) {
-            auto omega{rootOfUnityInverseTable[i + m]};
-            auto preconOmega{preconRootOfUnityInverseTable[i + m]};
-            for (uint32_t j1{i << logt}, j2{j1 + t}; j1 < j2; ++j1) {
-                auto loVal{(*element)[j1 + 0]};
-                auto hiVal{(*element)[j1 + t]};
-#if defined(__GNUC__) && !defined(__clang__)
-                auto omegaFactor{loVal};
-                if (omegaFactor < hiVal)
-                    omegaFactor += modulus;
-                omegaFactor -= hiVal;
-                loVal += hiVal;
-                if (loVal >= modulus)
-                    loVal -= modulus;
-                omegaFactor.ModMulFastConstEq(omega, modulus, preconOmega);
-                (*element)[j1 + 0] = loVal;
-                (*element)[j1 + t] = omegaFactor;
-#else
-                (*element)[j1 + 0] += hiVal - (hiVal >= (modulus - loVal) ? modulus : 0);
-                auto omegaFactor = loVal + (hiVal > loVal ? modulus : 0) - hiVal;
-                omegaFactor.ModMulFastConstEq(omega, modulus, preconOmega);
-                (*element)[j1 + t] = omegaFactor;
-#endif
+
+    // inner stages spanning several blocks
+    uint32_t m{(n >> 1) / tLocal}, t{tLocal};
+    while (m > 1) {
+        if (m >= 4) {
+            const uint32_t m2{m >> 1};
+            for (uint32_t i{0}; i < m2; ++i) {
+                const auto& omegaLo{rootOfUnityInverseTable[m + (i << 1) + 0]};
+                const auto& preconOmegaLo{preconRootOfUnityInverseTable[m + (i << 1) + 0]};
+                const auto& omegaHi{rootOfUnityInverseTable[m + (i << 1) + 1]};
+                const auto& preconOmegaHi{preconRootOfUnityInverseTable[m + (i << 1) + 1]};
+                const auto& omega{rootOfUnityInverseTable[m2 + i]};
+                const auto& preconOmega{preconRootOfUnityInverseTable[m2 + i]};
+                for (uint32_t j1{i * (t << 2)}, j2{j1 + t}; j1 < j2; ++j1) {
+                    auto x0{(*element)[j1 + 0]};
+                    auto x1{(*element)[j1 + t]};
+                    auto x2{(*element)[j1 + 2 * t]};
+                    auto x3{(*element)[j1 + 3 * t]};
+                    ButterflyGS(x0, x1, omegaLo, preconOmegaLo, modulus);
+                    ButterflyGS(x2, x3, omegaHi, preconOmegaHi, modulus);
+                    ButterflyGS(x0, x2, omega, preconOmega, modulus);
+                    ButterflyGS(x1, x3, omega, preconOmega, modulus);
+                    (*element)[j1 + 0]     = x0;
+                    (*element)[j1 + t]     = x1;
+                    (*element)[j1 + 2 * t] = x2;
+                    (*element)[j1 + 3 * t] = x3;
+                }
             }
+            m >>= 2;
+            t <<= 2;
+        }
+        else {
+            for (uint32_t i{0}; i < m; ++i) {
+                const auto& omega{rootOfUnityInverseTable[i + m]};
+                const auto& preconOmega{preconRootOfUnityInverseTable[i + m]};
+                for (uint32_t j1{i * (t << 1)}, j2{j1 + t}; j1 < j2; ++j1)
+                    ButterflyGS((*element)[j1 + 0], (*element)[j1 + t], omega, preconOmega, modulus);
+            }
+            m >>= 1;
+            t <<= 1;
         }
     }
 
@@ -598,27 +666,8 @@ void NumberTheoreticTransformNat<VecType>::InverseTransformFromBitReverseInPlace
     // by (n inverse) are incorporated into the omegaFactor calculation.
     // Please see https://github.com/openfheorg/openfhe-development/issues/872 for details.
     uint32_t j2{n >> 1};
-    for (uint32_t j1{0}; j1 < j2; ++j1) {
-        auto loVal{(*element)[j1]};
-        auto hiVal{(*element)[j1 + j2]};
-#if defined(__GNUC__) && !defined(__clang__)
-        auto omegaFactor{loVal};
-        if (omegaFactor < hiVal)
-            omegaFactor += modulus;
-        omegaFactor -= hiVal;
-        loVal += hiVal;
-        if (loVal >= modulus)
-            loVal -= modulus;
-        omegaFactor.ModMulFastConstEq(omega1Inv, modulus, preconOmega1Inv);
-        (*element)[j1 + 0]  = loVal;
-        (*element)[j1 + j2] = omegaFactor;
-#else
-        (*element)[j1] += hiVal - (hiVal >= (modulus - loVal) ? modulus : 0);
-        auto omegaFactor = loVal + (hiVal > loVal ? modulus : 0) - hiVal;
-        omegaFactor.ModMulFastConstEq(omega1Inv, modulus, preconOmega1Inv);
-        (*element)[j1 + j2] = omegaFactor;
-#endif
-    }
+    for (uint32_t j1{0}; j1 < j2; ++j1)
+        ButterflyGS((*element)[j1], (*element)[j1 + j2], omega1Inv, preconOmega1Inv, modulus);
     // perform remaining n/2 scalar multiplies by (n inverse)
     for (uint32_t i = 0; i < j2; ++i)
         (*element)[i].ModMulFastConstEq(cycloOrderInv, modulus, preconCycloOrderInv);
@@ -650,6 +699,7 @@ void ChineseRemainderTransformFTTNat<VecType>::ForwardTransformToBitReverseInPla
                                                                                    VecType* element) {
     if (rootOfUnity == IntType(1) || rootOfUnity == IntType(0))
         return;
+    PerfCounters::CountNTT();
     auto modulus = element->GetModulus();
     PreCompute(rootOfUnity, cycloOrder, modulus);
     NumberTheoreticTransformNat<VecType>().ForwardTransformToBitReverseInPlace(
@@ -665,6 +715,7 @@ void ChineseRemainderTransformFTTNat<VecType>::ForwardTransformToBitReverse(cons
         *result = element;
         return;
     }
+    PerfCounters::CountNTT();
     auto modulus = element.GetModulus();
     PreCompute(rootOfUnity, cycloOrder, modulus);
     NumberTheoreticTransformNat<VecType>().ForwardTransformToBitReverse(
@@ -680,6 +731,7 @@ void ChineseRemainderTransformFTTNat<VecType>::InverseTransformFromBitReverseInP
                                                                                      VecType* element) {
     if (rootOfUnity == IntType(1) || rootOfUnity == IntType(0))
         return;
+    PerfCounters::CountNTT();
     auto modulus = element->GetModulus();
     PreCompute(rootOfUnity, cycloOrder, modulus);
     uint32_t msb = GetMSB((cycloOrder >> 1) - 1);
@@ -698,6 +750,7 @@ void ChineseRemainderTransformFTTNat<VecType>::InverseTransformFromBitReverse(co
         *result = element;
         return;
     }
+    PerfCounters::CountNTT();
     auto modulus = element.GetModulus();
     result->SetModulus(modulus);
     PreCompute(rootOfUnity, cycloOrder, modulus);
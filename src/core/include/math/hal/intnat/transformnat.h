@@ -239,6 +239,26 @@ public:
                                                const VecType& preconRootOfUnityInverseTable,
                                                const IntType& cycloOrderInv, const IntType& preconCycloOrderInv,
                                                VecType* element);
+
+private:
+    /**
+   * Number of coefficients processed together by the cache-blocked stages of the
+   * precomputed-constant transforms: 2^12 64-bit words plus the twiddle factors used
+   * by the block fit in L1/L2 on current x86 and ARM cores.
+   */
+    static constexpr uint32_t NTT_BLOCK_LENGTH{1 << 12};
+
+    /**
+   * Cooley-Tukey butterfly: (lo, hi) <- (lo + hi*omega, lo - hi*omega) mod modulus
+   */
+    static void ButterflyCT(IntType& loVal, IntType& hiVal, const IntType& omega, const IntType& preconOmega,
+                            const IntType& modulus);
+
+    /**
+   * Gentleman-Sande butterfly: (lo, hi) <- (lo + hi, (lo - hi)*omega) mod modulus
+   */
+    static void ButterflyGS(IntType& loVal, IntType& hiVal, const IntType& omega, const IntType& preconOmega,
+                            const IntType& modulus);
 };
 
 /**
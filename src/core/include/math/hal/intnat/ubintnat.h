@@ -1485,6 +1485,102 @@ public:
         return *this;
     }
 
+    /*  The next subroutines implement Montgomery modular multiplication
+    (P. L. Montgomery, Modular Multiplication Without Trial Division, Math.
+    Comp. 44, 1985) with R = 2^MaxBits(). A value x is in Montgomery form when
+    it is stored as x*R mod q; the product of two values then needs only one
+    full and two single-word multiplications (REDC) and no 128-bit division
+    or Barrett constant. The modulus has to be odd and smaller than R/2, which
+    holds for all NTT-friendly moduli used by the RNS layer.
+    */
+
+    /**
+   * Precomputation for Montgomery multiplication: -q^{-1} mod 2^MaxBits(),
+   * where q is the current value.
+   *
+   * @return the negated inverse of the modulus modulo the word size.
+   */
+    NativeIntegerT ComputeMontgomeryInverse() const {
+        if ((m_value & 1) == 0)
+            OPENFHE_THROW("NativeIntegerT ComputeMontgomeryInverse: modulus must be odd");
+        // Newton iteration; q*q = 1 mod 8 for odd q, and every step doubles the number of correct bits
+        NativeInt inv{m_value};
+        for (uint32_t bits = 3; bits < NativeIntegerT::MaxBits(); bits <<= 1)
+            inv *= NativeInt(2) - m_value * inv;
+        return {NativeInt(0) - inv};
+    }
+
+    /**
+   * Converts the current value to Montgomery form: x*R mod q.
+   *
+   * @param &modulus is the modulus to perform operations with.
+   * @return the value in Montgomery form.
+   */
+    template <typename T = NativeInt>
+    NativeIntegerT ToMontgomery(const NativeIntegerT& modulus,
+                                typename std::enable_if_t<!std::is_same_v<T, DNativeInt>, bool> = true) const {
+        if (modulus.m_value == 0)
+            OPENFHE_THROW("Divide by zero");
+        auto&& w{DNativeInt(m_value) << NativeIntegerT::MaxBits()};
+        return {static_cast<NativeInt>(w % DNativeInt(modulus.m_value))};
+    }
+
+    template <typename T = NativeInt>
+    NativeIntegerT ToMontgomery(const NativeIntegerT& modulus,
+                                typename std::enable_if_t<std::is_same_v<T, DNativeInt>, bool> = true) const {
+        if (modulus.m_value == 0)
+            OPENFHE_THROW("Divide by zero");
+        auto&& w{bigintbackend::BigInteger(m_value) << NativeIntegerT::MaxBits()};
+        return {(w % bigintbackend::BigInteger(modulus.m_value)).template ConvertToInt<NativeInt>()};
+    }
+
+    /**
+   * Converts the current value from Montgomery form: x*R^{-1} mod q.
+   *
+   * @param &modulus is the modulus to perform operations with.
+   * @param &qInv precomputation from ComputeMontgomeryInverse().
+   * @return the value in standard form.
+   */
+    NativeIntegerT FromMontgomery(const NativeIntegerT& modulus, const NativeIntegerT& qInv) const {
+        NativeInt m{static_cast<NativeInt>(m_value * qInv.m_value)};
+        NativeInt r{static_cast<NativeInt>(MultDHi(m, modulus.m_value) + (m_value != 0))};
+        return {r >= modulus.m_value ? r - modulus.m_value : r};
+    }
+
+    /**
+   * Montgomery modular multiplication: computes a*b*R^{-1} mod q. When both
+   * operands are in Montgomery form, so is the result. Both operands have to
+   * be smaller than the modulus.
+   *
+   * @param &b is the NativeIntegerT to multiply.
+   * @param &modulus is the modulus to perform operations with.
+   * @param &qInv precomputation from ComputeMontgomeryInverse().
+   * @return is the result of the modulus multiplication operation.
+   */
+    NativeIntegerT ModMulMontgomery(const NativeIntegerT& b, const NativeIntegerT& modulus,
+                                    const NativeIntegerT& qInv) const {
+        return NativeIntegerT(*this).ModMulMontgomeryEq(b, modulus, qInv);
+    }
+
+    /**
+   * Montgomery modular multiplication. In-place variant.
+   *
+   * @param &b is the NativeIntegerT to multiply.
+   * @param &modulus is the modulus to perform operations with.
+   * @param &qInv precomputation from ComputeMontgomeryInverse().
+   * @return is the result of the modulus multiplication operation.
+   */
+    NativeIntegerT& ModMulMontgomeryEq(const NativeIntegerT& b, const NativeIntegerT& modulus,
+                                       const NativeIntegerT& qInv) {
+        typeD prod;
+        MultD(m_value, b.m_value, prod);
+        // the low word of prod + m*q is zero by construction; it carries into the high word iff prod.lo != 0
+        NativeInt m{static_cast<NativeInt>(prod.lo * qInv.m_value)};
+        NativeInt r{static_cast<NativeInt>(prod.hi + MultDHi(m, modulus.m_value) + (prod.lo != 0))};
+        m_value = (r >= modulus.m_value) ? r - modulus.m_value : r;
+        return *this;
+    }
+
     /**
    * Modulus exponentiation operation.
    *
@@ -44,12 +44,17 @@
 #include "utils/debug.h"
 #include "utils/exception.h"
 #include "utils/inttypes.h"
+#include "utils/parallel.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <map>
+#include <mutex>
 #include <set>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace lbcrypto {
@@ -180,7 +185,7 @@ bool IsGenerator(const IntType& g, const IntType& q) {
  output:  root of unity (in format of BigInteger)
  */
 template <typename IntType>
-IntType RootOfUnity(usint m, const IntType& modulo) {
+static IntType ComputeRootOfUnity(usint m, const IntType& modulo) {
     IntType M(m);
     if ((modulo - IntType(1)).Mod(M) != IntType(0)) {
         std::string errMsg =
@@ -194,7 +199,7 @@ IntType RootOfUnity(usint m, const IntType& modulo) {
     IntType gen    = FindGenerator(modulo);
     IntType result = gen.ModExp((modulo - IntType(1)).DividedBy(M), modulo);
     if (result == IntType(1))
-        result = RootOfUnity(m, modulo);
+        return ComputeRootOfUnity(m, modulo);
 
     /*
    * At this point, result contains a primitive root of unity. However,
@@ -215,14 +220,18 @@ IntType RootOfUnity(usint m, const IntType& modulo) {
     IntType x(1);
     x.ModMulEq(result, modulo, mu);
 
+    // the gaps between consecutive coprimes are small, so result^gap is precomputed for each gap seen so far
+    std::vector<IntType> stepPow{IntType(1), result};
     std::vector<IntType> coprimes = GetTotientList<IntType>(m);
     IntType minRU(x);
-    IntType curPowIdx(1);
+    uint64_t curPowIdx = 1;
     for (size_t i = 0; i < coprimes.size(); ++i) {
-        auto nextPowIdx = coprimes[i];
-        IntType diffPow(nextPowIdx - curPowIdx);
-        for (IntType j(0); j < diffPow; j += IntType(1))
-            x.ModMulEq(result, modulo, mu);
+        uint64_t nextPowIdx = coprimes[i].ConvertToInt();
+        uint64_t diffPow    = nextPowIdx - curPowIdx;
+        while (stepPow.size() <= diffPow)
+            stepPow.push_back(stepPow.back().ModMul(result, modulo, mu));
+        if (diffPow > 0)
+            x.ModMulEq(stepPow[diffPow], modulo, mu);
         if (x < minRU && x != IntType(1))
             minRU = x;
         curPowIdx = nextPowIdx;
@@ -230,9 +239,30 @@ IntType RootOfUnity(usint m, const IntType& modulo) {
     return minRU;
 }
 
+template <typename IntType>
+IntType RootOfUnity(usint m, const IntType& modulo) {
+    // The minimum primitive root of unity is unique for (m, modulo), so it is computed once per process and shared
+    // by all crypto contexts using the same modulus
+    static std::map<std::pair<usint, IntType>, IntType> s_roots;
+    static std::mutex s_rootsMutex;
+    {
+        std::lock_guard<std::mutex> lock(s_rootsMutex);
+        auto it = s_roots.find({m, modulo});
+        if (it != s_roots.end())
+            return it->second;
+    }
+
+    IntType root = ComputeRootOfUnity(m, modulo);
+
+    std::lock_guard<std::mutex> lock(s_rootsMutex);
+    s_roots.emplace(std::make_pair(m, modulo), root);
+    return root;
+}
+
 template <typename IntType>
 std::vector<IntType> RootsOfUnity(usint m, const std::vector<IntType>& moduli) {
     std::vector<IntType> rootsOfUnity(moduli.size());
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(moduli.size()))
     for (size_t i = 0; i < moduli.size(); ++i)
         rootsOfUnity[i] = RootOfUnity(m, moduli[i]);
     return rootsOfUnity;
@@ -398,14 +428,36 @@ IntType NextPowerOfTwo(IntType n) {
     return result;
 }
 
-/*Naive Loop to find coprimes to n*/
+template <typename IntType>
+static inline uint64_t TotientArgToInt(const IntType& n) {
+    return n.ConvertToInt();
+}
+
+static inline uint64_t TotientArgToInt(usint n) {
+    return n;
+}
+
+/*Finds the coprimes to n by sieving with the distinct prime factors of n*/
 template <typename IntType>
 std::vector<IntType> GetTotientList(const IntType& n) {
+    const uint64_t nInt = TotientArgToInt(n);
+
+    std::vector<uint64_t> primeFactors;
+    uint64_t rem = nInt;
+    for (uint64_t p = 2; p * p <= rem; ++p) {
+        if (rem % p == 0) {
+            primeFactors.push_back(p);
+            while (rem % p == 0)
+                rem /= p;
+        }
+    }
+    if (rem > 1)
+        primeFactors.push_back(rem);
+
     std::vector<IntType> result;
-    static const IntType one(1);
-    for (IntType i = one; i < n; i = i + one) {
-        if (GreatestCommonDivisor(i, n) == one)
-            result.push_back(i);
+    for (uint64_t i = 1; i < nInt; ++i) {
+        if (std::all_of(primeFactors.begin(), primeFactors.end(), [i](uint64_t p) { return i % p != 0; }))
+            result.emplace_back(i);
     }
     return result;
 }
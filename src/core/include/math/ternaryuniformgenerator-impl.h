@@ -40,27 +40,27 @@
 #include "math/ternaryuniformgenerator.h"
 
 #include "utils/inttypes.h"
+#include "utils/memory.h"
 
+#include <limits>
 #include <memory>
 #include <random>
 #include <vector>
 
 namespace lbcrypto {
 
-template <typename VecType>
-std::uniform_int_distribution<int32_t> TernaryUniformGeneratorImpl<VecType>::m_distribution =
-    std::uniform_int_distribution<int32_t>(-1, 1);
-
 template <typename VecType>
 VecType TernaryUniformGeneratorImpl<VecType>::GenerateVector(uint32_t size, const typename VecType::Integer& modulus,
                                                              uint32_t h) const {
     if (h == 0) {
         // regular ternary distribution
         VecType v(size, modulus, modulus - typename VecType::Integer(1));
+        auto rn = GenerateIntVector(size);
         for (uint32_t i = 0; i < size; ++i) {
-            if (auto rn = m_distribution(PseudoRandomNumberGenerator::GetPRNG()); rn >= 0)
-                v[i] = typename VecType::Integer(rn);
+            if (rn[i] >= 0)
+                v[i] = typename VecType::Integer(rn[i]);
         }
+        secure_memset(rn.data(), 0, rn.size() * sizeof(rn[0]));
         return v;
     }
 
@@ -102,9 +102,29 @@ VecType TernaryUniformGeneratorImpl<VecType>::GenerateVector(uint32_t size, cons
 template <typename VecType>
 std::vector<int32_t> TernaryUniformGeneratorImpl<VecType>::GenerateIntVector(uint32_t size, uint32_t h) const {
     if (h == 0) {
+        // every PRNG sample is split into 16 candidates of 2 bits; 0, 1, 2 are mapped to -1, 0, 1 and 3 is rejected
         std::vector<int32_t> v(size);
-        for (uint32_t i = 0; i < size; ++i)
-            v[i] = m_distribution(PseudoRandomNumberGenerator::GetPRNG());
+        std::vector<PRNG::result_type> block(TUG_BLOCK_SIZE);
+        size_t pos          = block.size();
+        PRNG::result_type w = 0;
+        uint32_t bits       = 0;
+        for (uint32_t i = 0; i < size;) {
+            if (bits == 0) {
+                if (pos == block.size()) {
+                    PseudoRandomNumberGenerator::Fill(block.data(), block.size());
+                    pos = 0;
+                }
+                w    = block[pos++];
+                bits = std::numeric_limits<PRNG::result_type>::digits;
+            }
+            const int32_t c = w & 0x3;
+            w >>= 2;
+            bits -= 2;
+            if (c != 3)
+                v[i++] = c - 1;
+        }
+        // IMPORTANT: clear the unused PRNG samples for security reasons
+        secure_memset(block.data(), 0, block.size() * sizeof(block[0]));
         return v;
     }
 
@@ -45,6 +45,9 @@
 
 namespace lbcrypto {
 
+// number of PRNG samples drawn at once by the non-sparse ternary distribution
+constexpr size_t TUG_BLOCK_SIZE{64};
+
 /**
  * @brief A generator of the Ternary Uniform Distribution.
  */
@@ -80,9 +83,6 @@ public:
    * @return     vector of integer values generated with the distribution
    */
     std::vector<int32_t> GenerateIntVector(uint32_t size, uint32_t h = 0) const;
-
-private:
-    static std::uniform_int_distribution<int32_t> m_distribution;
 };
 
 }  // namespace lbcrypto
@@ -81,6 +81,11 @@ class Blake2Engine : public PRNG {
         return result;
     }
 
+    /**
+     * @brief fills out with the next count samples; the samples are the same as those of count calls to operator()
+     */
+    void Fill(PRNG::result_type* out, size_t count);
+
  private:
     /**
      * @brief The main call to blake2xb function
@@ -0,0 +1,210 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Lightweight performance counters for the main FHE operations
+ */
+
+#ifndef LBCRYPTO_UTILS_PROFILER_H
+#define LBCRYPTO_UTILS_PROFILER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <map>
+#include <string>
+
+namespace lbcrypto {
+
+/**
+ * @brief Operations tracked by PerfCounters. The bootstrapping phases are also accounted for in EVAL_BOOTSTRAP, and
+ * the double-angle iterations in BOOT_EVAL_MOD.
+ */
+enum class PerfOp : uint32_t {
+    EVAL_MULT = 0,
+    EVAL_ROTATE,
+    KEY_SWITCH,
+    MOD_REDUCE,
+    EVAL_BOOTSTRAP,
+    BOOT_MOD_RAISE,
+    BOOT_COEFFS_TO_SLOTS,
+    BOOT_EVAL_MOD,
+    BOOT_DOUBLE_ANGLE,
+    BOOT_SLOTS_TO_COEFFS,
+    BINFHE_BOOTSTRAP,
+    NUM_PERF_OPS,
+};
+
+/**
+ * @brief Accumulated statistics for one operation. The NTT, key-switching and allocation counts are the
+ * process-wide events observed while the operation was running, so nested operations are included in their parents.
+ */
+struct PerfCounter {
+    uint64_t count{0};
+    uint64_t wallTimeNs{0};
+    uint64_t maxWallTimeNs{0};
+    uint64_t cpuTimeNs{0};
+    uint64_t ntts{0};
+    uint64_t keySwitches{0};
+    uint64_t bytesAllocated{0};
+
+    /**
+     * @brief Average number of busy cores while the operation was running (process CPU time over wall time)
+     */
+    double ThreadUtilization() const {
+        return (wallTimeNs == 0) ? 0.0 : static_cast<double>(cpuTimeNs) / static_cast<double>(wallTimeNs);
+    }
+};
+
+/**
+ * @brief Process-wide performance counters. Collection is off by default and costs a single relaxed atomic load per
+ * instrumented call; it can be switched on at run time with Enable() or by setting the environment variable
+ * OPENFHE_PERF_COUNTERS to a value other than 0 before the program starts.
+ */
+class PerfCounters {
+public:
+    static void Enable(bool enable = true) {
+        s_enabled.store(enable, std::memory_order_relaxed);
+    }
+
+    static void Disable() {
+        Enable(false);
+    }
+
+    static bool IsEnabled() {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Clears all per-operation statistics and the global event totals
+     */
+    static void Reset();
+
+    /**
+     * @brief Returns a copy of the statistics accumulated for a single operation
+     */
+    static PerfCounter Get(PerfOp op);
+
+    /**
+     * @brief Returns the statistics of all operations keyed by operation name
+     */
+    static std::map<std::string, PerfCounter> GetSnapshot();
+
+    /**
+     * @brief Serializes the global totals and the per-operation statistics as a JSON object
+     */
+    static std::string ToJSON();
+
+    static const char* GetName(PerfOp op);
+
+    static uint64_t GetTotalNTTs() {
+        return s_ntts.load(std::memory_order_relaxed);
+    }
+
+    static uint64_t GetTotalKeySwitches() {
+        return s_keySwitches.load(std::memory_order_relaxed);
+    }
+
+    static uint64_t GetTotalBytesAllocated() {
+        return s_bytesAllocated.load(std::memory_order_relaxed);
+    }
+
+    // hooks called from the number-theoretic transforms and the polynomial allocators
+    static void CountNTT() {
+        if (IsEnabled())
+            s_ntts.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static void CountBytes(uint64_t bytes) {
+        if (IsEnabled())
+            s_bytesAllocated.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+private:
+    friend class PerfScope;
+
+    static void Record(PerfOp op, uint64_t count, uint64_t wallTimeNs, uint64_t cpuTimeNs, uint64_t ntts,
+                       uint64_t keySwitches, uint64_t bytesAllocated);
+
+    static std::atomic<bool> s_enabled;
+    static std::atomic<uint64_t> s_ntts;
+    static std::atomic<uint64_t> s_keySwitches;
+    static std::atomic<uint64_t> s_bytesAllocated;
+};
+
+/**
+ * @brief RAII helper attributing the time and the events between its construction and Stop() (or destruction) to
+ * an operation. It does nothing when the counters are disabled at construction time.
+ */
+class PerfScope {
+public:
+    /**
+     * @param op the operation to attribute the scope to
+     * @param count number of operations performed by the scope; a scope with zero operations is not recorded
+     */
+    explicit PerfScope(PerfOp op, uint64_t count = 1) : m_op(op), m_count(count) {
+        if (m_count != 0 && PerfCounters::IsEnabled())
+            Start();
+    }
+
+    ~PerfScope() {
+        Stop();
+    }
+
+    PerfScope(const PerfScope&)            = delete;
+    PerfScope& operator=(const PerfScope&) = delete;
+
+    /**
+     * @brief Records the scope early; later calls and the destructor are no-ops
+     */
+    void Stop() {
+        if (m_active)
+            Finish();
+    }
+
+private:
+    void Start();
+    void Finish();
+
+    PerfOp m_op;
+    uint64_t m_count;
+    bool m_active{false};
+    std::chrono::steady_clock::time_point m_wallStart;
+    std::clock_t m_cpuStart{0};
+    uint64_t m_nttsStart{0};
+    uint64_t m_keySwitchesStart{0};
+    uint64_t m_bytesStart{0};
+};
+
+}  // namespace lbcrypto
+
+#endif  // LBCRYPTO_UTILS_PROFILER_H
@@ -100,5 +100,14 @@ inline uint64_t BarrettUint128ModUint64(const DoubleNativeInt& a, uint64_t modul
 }
 #endif
 
+#if NATIVEINT == 32
+/**
+ * Number of products of two residues below 2^MAX_MODULUS_SIZE that fit in a
+ * 64-bit accumulator. The RNS base conversions for 32-bit limbs sum up to
+ * this many products before reducing once, instead of reducing every term.
+ */
+constexpr uint32_t LAZY_ACC_TERMS_32 = uint32_t(1) << (64 - 2 * MAX_MODULUS_SIZE);
+#endif
+
 }  // namespace lbcrypto
 #endif  // __UTILITIES_INT_H__
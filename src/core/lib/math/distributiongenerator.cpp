@@ -109,4 +109,15 @@ PRNG& PseudoRandomNumberGenerator::GetPRNG() {
     return *m_prng;
 }
 
+void PseudoRandomNumberGenerator::Fill(PRNG::result_type* out, size_t count) {
+    PRNG& prng = GetPRNG();
+    if (genPRNGEngine == default_prng::createEngineInstance) {
+        static_cast<default_prng::Blake2Engine&>(prng).Fill(out, count);
+        return;
+    }
+    // external engines only implement the PRNG interface
+    for (size_t i = 0; i < count; ++i)
+        out[i] = prng();
+}
+
 }  // namespace lbcrypto
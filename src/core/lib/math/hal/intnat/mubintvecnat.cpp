@@ -338,6 +338,54 @@ NativeVectorT<IntegerType>& NativeVectorT<IntegerType>::ModMulEq(const NativeVec
     return *this;
 }
 
+template <class IntegerType>
+NativeVectorT<IntegerType>& NativeVectorT<IntegerType>::ToMontgomeryEq() {
+    auto mv{m_modulus};
+    auto qInv{m_modulus.ComputeMontgomeryInverse()};
+    // R^2 mod q; one REDC with it maps x to x*R mod q without a division per entry
+    auto r2{IntegerType(1).ToMontgomery(mv).ToMontgomery(mv)};
+    size_t size{m_data.size()};
+    for (size_t i = 0; i < size; ++i)
+        m_data[i].ModMulMontgomeryEq(r2, mv, qInv);
+    return *this;
+}
+
+template <class IntegerType>
+NativeVectorT<IntegerType>& NativeVectorT<IntegerType>::FromMontgomeryEq() {
+    auto mv{m_modulus};
+    auto qInv{m_modulus.ComputeMontgomeryInverse()};
+    size_t size{m_data.size()};
+    for (size_t i = 0; i < size; ++i)
+        m_data[i] = m_data[i].FromMontgomery(mv, qInv);
+    return *this;
+}
+
+template <class IntegerType>
+NativeVectorT<IntegerType>& NativeVectorT<IntegerType>::ModMulMontgomeryEq(const NativeVectorT& b) {
+    if (m_data.size() != b.m_data.size() || m_modulus != b.m_modulus)
+        OPENFHE_THROW("Called on NativeVectorT's with different parameters.");
+    auto mv{m_modulus};
+    auto qInv{m_modulus.ComputeMontgomeryInverse()};
+    size_t size{m_data.size()};
+    for (size_t i = 0; i < size; ++i)
+        m_data[i].ModMulMontgomeryEq(b[i], mv, qInv);
+    return *this;
+}
+
+template <class IntegerType>
+NativeVectorT<IntegerType>& NativeVectorT<IntegerType>::ModMulAddMontgomeryEq(const NativeVectorT& a,
+                                                                              const NativeVectorT& b) {
+    if (m_data.size() != a.m_data.size() || m_data.size() != b.m_data.size() || m_modulus != a.m_modulus ||
+        m_modulus != b.m_modulus)
+        OPENFHE_THROW("Called on NativeVectorT's with different parameters.");
+    auto mv{m_modulus};
+    auto qInv{m_modulus.ComputeMontgomeryInverse()};
+    size_t size{m_data.size()};
+    for (size_t i = 0; i < size; ++i)
+        m_data[i].ModAddFastEq(a[i].ModMulMontgomery(b[i], mv, qInv), mv);
+    return *this;
+}
+
 template <class IntegerType>
 NativeVectorT<IntegerType> NativeVectorT<IntegerType>::ModByTwo() const {
     auto ans(*this);
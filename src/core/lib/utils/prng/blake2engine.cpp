@@ -33,6 +33,7 @@
 #include "utils/exception.h"
 #include "utils/memory.h"
 
+#include <algorithm>
 #include <chrono>
 #include <random>
 #include <thread>
@@ -55,6 +56,23 @@ void Blake2Engine::Generate() {
     m_counter++;
 }
 
+void Blake2Engine::Fill(PRNG::result_type* out, size_t count) {
+    while (count > 0) {
+        if (m_bufferIndex == static_cast<size_t>(PRNG_BUFFER_SIZE))
+            m_bufferIndex = 0;
+
+        if (m_bufferIndex == 0)
+            Generate();
+
+        // copies as many buffered samples as possible at once
+        const size_t n = std::min(count, static_cast<size_t>(PRNG_BUFFER_SIZE) - m_bufferIndex);
+        std::copy_n(m_buffer.begin() + m_bufferIndex, n, out);
+        m_bufferIndex += n;
+        out += n;
+        count -= n;
+    }
+}
+
 extern "C" {
 // if FIXED_SEED is defined, then PRNG uses a fixed seed number for reproducible results during debug.
 // Use only one OMP thread to ensure reproducibility
@@ -0,0 +1,185 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Lightweight performance counters for the main FHE operations
+ */
+
+#include "utils/profiler.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+namespace lbcrypto {
+
+std::atomic<bool> PerfCounters::s_enabled{false};
+std::atomic<uint64_t> PerfCounters::s_ntts{0};
+std::atomic<uint64_t> PerfCounters::s_keySwitches{0};
+std::atomic<uint64_t> PerfCounters::s_bytesAllocated{0};
+
+namespace {
+
+constexpr uint32_t NUM_OPS = static_cast<uint32_t>(PerfOp::NUM_PERF_OPS);
+
+const char* const OP_NAMES[NUM_OPS] = {
+    "EvalMult",          "EvalRotate",  "KeySwitch",       "ModReduce",         "EvalBootstrap",   "BootModRaise",
+    "BootCoeffsToSlots", "BootEvalMod", "BootDoubleAngle", "BootSlotsToCoeffs", "BinFHEBootstrap",
+};
+
+// the totals may have been reset while a scope was running
+inline uint64_t Delta(uint64_t current, uint64_t start) {
+    return (current >= start) ? current - start : 0;
+}
+
+struct AtomicPerfCounter {
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> wallTimeNs{0};
+    std::atomic<uint64_t> maxWallTimeNs{0};
+    std::atomic<uint64_t> cpuTimeNs{0};
+    std::atomic<uint64_t> ntts{0};
+    std::atomic<uint64_t> keySwitches{0};
+    std::atomic<uint64_t> bytesAllocated{0};
+};
+
+AtomicPerfCounter g_perfCounters[NUM_OPS];
+
+// enables the counters for the whole run when OPENFHE_PERF_COUNTERS is set, so no rebuild is needed
+struct PerfCountersEnvironment {
+    PerfCountersEnvironment() {
+        const char* env = std::getenv("OPENFHE_PERF_COUNTERS");
+        if (env != nullptr && *env != '\0' && std::strcmp(env, "0") != 0)
+            PerfCounters::Enable();
+    }
+} g_perfCountersEnvironment;
+
+}  // namespace
+
+void PerfCounters::Reset() {
+    for (auto& c : g_perfCounters) {
+        c.count.store(0, std::memory_order_relaxed);
+        c.wallTimeNs.store(0, std::memory_order_relaxed);
+        c.maxWallTimeNs.store(0, std::memory_order_relaxed);
+        c.cpuTimeNs.store(0, std::memory_order_relaxed);
+        c.ntts.store(0, std::memory_order_relaxed);
+        c.keySwitches.store(0, std::memory_order_relaxed);
+        c.bytesAllocated.store(0, std::memory_order_relaxed);
+    }
+    s_ntts.store(0, std::memory_order_relaxed);
+    s_keySwitches.store(0, std::memory_order_relaxed);
+    s_bytesAllocated.store(0, std::memory_order_relaxed);
+}
+
+PerfCounter PerfCounters::Get(PerfOp op) {
+    const auto& c = g_perfCounters[static_cast<uint32_t>(op) % NUM_OPS];
+    PerfCounter result;
+    result.count          = c.count.load(std::memory_order_relaxed);
+    result.wallTimeNs     = c.wallTimeNs.load(std::memory_order_relaxed);
+    result.maxWallTimeNs  = c.maxWallTimeNs.load(std::memory_order_relaxed);
+    result.cpuTimeNs      = c.cpuTimeNs.load(std::memory_order_relaxed);
+    result.ntts           = c.ntts.load(std::memory_order_relaxed);
+    result.keySwitches    = c.keySwitches.load(std::memory_order_relaxed);
+    result.bytesAllocated = c.bytesAllocated.load(std::memory_order_relaxed);
+    return result;
+}
+
+std::map<std::string, PerfCounter> PerfCounters::GetSnapshot() {
+    std::map<std::string, PerfCounter> snapshot;
+    for (uint32_t i = 0; i < NUM_OPS; ++i)
+        snapshot.emplace(OP_NAMES[i], Get(static_cast<PerfOp>(i)));
+    return snapshot;
+}
+
+std::string PerfCounters::ToJSON() {
+    std::ostringstream s;
+    s << std::fixed << std::setprecision(3);
+    s << "{\"enabled\":" << (IsEnabled() ? "true" : "false") << ",\"totals\":{\"ntts\":" << GetTotalNTTs()
+      << ",\"keySwitches\":" << GetTotalKeySwitches() << ",\"bytesAllocated\":" << GetTotalBytesAllocated()
+      << "},\"ops\":{";
+    for (uint32_t i = 0; i < NUM_OPS; ++i) {
+        const auto c = Get(static_cast<PerfOp>(i));
+        s << (i ? "," : "") << "\"" << OP_NAMES[i] << "\":{\"count\":" << c.count << ",\"wallTimeNs\":" << c.wallTimeNs
+          << ",\"maxWallTimeNs\":" << c.maxWallTimeNs << ",\"cpuTimeNs\":" << c.cpuTimeNs << ",\"ntts\":" << c.ntts
+          << ",\"keySwitches\":" << c.keySwitches << ",\"bytesAllocated\":" << c.bytesAllocated
+          << ",\"threadUtilization\":" << c.ThreadUtilization() << "}";
+    }
+    s << "}}";
+    return s.str();
+}
+
+const char* PerfCounters::GetName(PerfOp op) {
+    const auto i = static_cast<uint32_t>(op);
+    return (i < NUM_OPS) ? OP_NAMES[i] : "Unknown";
+}
+
+void PerfCounters::Record(PerfOp op, uint64_t count, uint64_t wallTimeNs, uint64_t cpuTimeNs, uint64_t ntts,
+                          uint64_t keySwitches, uint64_t bytesAllocated) {
+    auto& c = g_perfCounters[static_cast<uint32_t>(op) % NUM_OPS];
+    c.count.fetch_add(count, std::memory_order_relaxed);
+    c.wallTimeNs.fetch_add(wallTimeNs, std::memory_order_relaxed);
+    c.cpuTimeNs.fetch_add(cpuTimeNs, std::memory_order_relaxed);
+    c.ntts.fetch_add(ntts, std::memory_order_relaxed);
+    c.keySwitches.fetch_add(keySwitches, std::memory_order_relaxed);
+    c.bytesAllocated.fetch_add(bytesAllocated, std::memory_order_relaxed);
+
+    uint64_t prevMax = c.maxWallTimeNs.load(std::memory_order_relaxed);
+    while (prevMax < wallTimeNs &&
+           !c.maxWallTimeNs.compare_exchange_weak(prevMax, wallTimeNs, std::memory_order_relaxed)) {
+    }
+}
+
+void PerfScope::Start() {
+    m_active           = true;
+    m_nttsStart        = PerfCounters::GetTotalNTTs();
+    m_keySwitchesStart = PerfCounters::GetTotalKeySwitches();
+    m_bytesStart       = PerfCounters::GetTotalBytesAllocated();
+
+    // a key switch is counted when it starts so that it is observed by itself and by all enclosing scopes
+    if (m_op == PerfOp::KEY_SWITCH)
+        PerfCounters::s_keySwitches.fetch_add(m_count, std::memory_order_relaxed);
+
+    m_cpuStart         = std::clock();
+    m_wallStart        = std::chrono::steady_clock::now();
+}
+
+void PerfScope::Finish() {
+    auto wall = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_wallStart);
+    auto cpu  = static_cast<double>(std::clock() - m_cpuStart) * (1e9 / CLOCKS_PER_SEC);
+
+    m_active = false;
+    PerfCounters::Record(m_op, m_count, static_cast<uint64_t>(wall.count()), static_cast<uint64_t>(cpu),
+                         Delta(PerfCounters::GetTotalNTTs(), m_nttsStart),
+                         Delta(PerfCounters::GetTotalKeySwitches(), m_keySwitchesStart),
+                         Delta(PerfCounters::GetTotalBytesAllocated(), m_bytesStart));
+}
+
+}  // namespace lbcrypto
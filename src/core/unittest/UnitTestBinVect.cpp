@@ -545,3 +545,52 @@ void modmul_vector(const std::string& msg) {
 TEST(UTBinVect, modmul_vector) {
     RUN_BIG_BACKENDS(modmul_vector, "modmul_vector")
 }
+
+// --------------- TESTING MONTGOMERY MULTIPLICATION (NATIVE ONLY) ---------------
+
+/*   Montgomery products of standard-form vectors carry an extra factor R^{-1};
+        a round trip through Montgomery form and an accumulated inner product
+        with a single final ToMontgomeryEq() must match the Barrett results.
+*/
+
+TEST(UTBinVect, modmul_montgomery_native) {
+    constexpr usint n = 64;
+    for (usint bits : {20, 40, 50, 60}) {
+        auto q = LastPrime<NativeInteger>(bits, 2 * n);
+        DiscreteUniformGeneratorImpl<NativeVector> dug;
+        auto a = dug.GenerateVector(n, q);
+        auto b = dug.GenerateVector(n, q);
+        auto c = dug.GenerateVector(n, q);
+
+        // round trip
+        auto am = a;
+        am.ToMontgomeryEq();
+        EXPECT_EQ(am[1], a[1].ToMontgomery(q)) << "ToMontgomery " << bits;
+        am.FromMontgomeryEq();
+        EXPECT_EQ(a, am) << "Montgomery round trip " << bits;
+
+        // products stay in Montgomery form
+        auto bm = b;
+        am.ToMontgomeryEq();
+        bm.ToMontgomeryEq();
+        am.ModMulMontgomeryEq(bm);
+        am.FromMontgomeryEq();
+        EXPECT_EQ(a.ModMul(b), am) << "ModMulMontgomeryEq " << bits;
+
+        // inner product with deferred correction
+        NativeVector acc(n, q);
+        acc.ModMulAddMontgomeryEq(a, b);
+        acc.ModMulAddMontgomeryEq(c, b);
+        acc.ToMontgomeryEq();
+        EXPECT_EQ(a.ModMul(b).ModAdd(c.ModMul(b)), acc) << "ModMulAddMontgomeryEq " << bits;
+
+        // edge values
+        NativeInteger qm1 = q - NativeInteger(1);
+        auto qInv         = q.ComputeMontgomeryInverse();
+        EXPECT_EQ(qm1.ToMontgomery(q).ModMulMontgomery(qm1.ToMontgomery(q), q, qInv).FromMontgomery(q, qInv),
+                  NativeInteger(1))
+            << "(q-1)^2 " << bits;
+        EXPECT_EQ(NativeInteger(0).FromMontgomery(q, qInv), NativeInteger(0)) << "zero " << bits;
+    }
+    EXPECT_THROW(NativeInteger(1024).ComputeMontgomeryInverse(), OpenFHEException);
+}
@@ -36,10 +36,12 @@
 #include "testdefs.h"
 #include "utils/debug.h"
 #include "utils/inttypes.h"
+#include "utils/prng/blake2engine.h"
 #include "utils/utilities.h"
 
 #include <iostream>
 #include <thread>
+#include <vector>
 
 using namespace lbcrypto;
 
@@ -414,6 +416,25 @@ TEST(UTDistrGen, TernaryUniformGenerator) {
     RUN_ALL_BACKENDS(TernaryUniformGeneratorTest, "TernaryUniformGeneratorTest")
 }
 
+// bulk Fill must yield the same stream as repeated calls to operator()
+TEST(UTDistrGen, Blake2EngineFill) {
+    default_prng::Blake2Engine::blake2_seed_array_t seed{};
+    for (size_t i = 0; i < seed.size(); ++i)
+        seed[i] = static_cast<PRNG::result_type>(0x9e3779b9u * (i + 1));
+
+    default_prng::Blake2Engine engineA(seed, 0);
+    default_prng::Blake2Engine engineB(seed, 0);
+
+    // chunk lengths chosen to straddle the internal buffer boundary
+    std::vector<size_t> chunks{1, 7, 1000, 1024, 3, 2500};
+    for (size_t count : chunks) {
+        std::vector<PRNG::result_type> filled(count);
+        engineA.Fill(filled.data(), count);
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_EQ(filled[i], engineB()) << "Blake2Engine::Fill differs at chunk " << count << ", index " << i;
+    }
+}
+
 ////////////////////////////////////////////////
 // Testing Methods of BigInteger DiscreteGaussianGenerator
 ////////////////////////////////////////////////
@@ -368,3 +368,34 @@ void CRT_CHECK_very_big_ring_precomputed(const std::string& msg) {
 TEST(UTTransform, CRT_CHECK_very_big_ring_precomputed) {
     RUN_BIG_BACKENDS(CRT_CHECK_very_big_ring_precomputed, "CRT_CHECK_very_big_ring_precomputed")
 }
+
+// ring dimension above NTT_BLOCK_LENGTH so that the radix-4 and cache-blocked stages are exercised
+TEST(UTTransform, CRT_native_blocked_ring) {
+    constexpr usint logn       = 14;
+    constexpr usint n          = 1 << logn;
+    constexpr usint cycloOrder = 2 * n;
+
+    NativeInteger modulus = LastPrime<NativeInteger>(MAX_MODULUS_SIZE, cycloOrder);
+    NativeInteger root    = RootOfUnity<NativeInteger>(cycloOrder, modulus);
+
+    DiscreteUniformGeneratorImpl<NativeVector> dug;
+    dug.SetModulus(modulus);
+    NativeVector input = dug.GenerateVector(n);
+
+    NativeVector output(input);
+    ChineseRemainderTransformFTT<NativeVector>().ForwardTransformToBitReverseInPlace(root, cycloOrder, &output);
+
+    // the k-th output in bit-reversed order is input(root^(2*br(k)+1))
+    for (usint k : {0u, 1u, 5u, n / 2 - 1, n / 2 + 3, n - 1}) {
+        NativeInteger omega = root.ModExp(2 * ReverseBits(k, logn) + 1, modulus);
+        NativeInteger power(1), expected(0);
+        for (usint i = 0; i < n; ++i) {
+            expected.ModAddFastEq(input[i].ModMul(power, modulus), modulus);
+            power.ModMulEq(omega, modulus);
+        }
+        EXPECT_EQ(expected, output[k]) << "forward transform, index " << k;
+    }
+
+    ChineseRemainderTransformFTT<NativeVector>().InverseTransformFromBitReverseInPlace(root, cycloOrder, &output);
+    EXPECT_EQ(input, output) << "inverse transform";
+}
@@ -30,10 +30,14 @@
 //==================================================================================
 
 #include "include/gtest/gtest.h"
+#include "lattice/lat-hal.h"
+#include "utils/profiler.h"
 #include "utils/utilities.h"
 
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <string>
 
 using namespace lbcrypto;
 
@@ -49,3 +53,58 @@ TEST(Utilities, IsPowerOfTwo) {
         EXPECT_FALSE(IsPowerOfTwo(not_power_of_two));
     }
 }
+
+TEST(Utilities, PerfCounters) {
+    const bool wasEnabled = PerfCounters::IsEnabled();
+
+    PerfCounters::Disable();
+    PerfCounters::Reset();
+    {
+        PerfScope scope(PerfOp::EVAL_MULT);
+    }
+    EXPECT_EQ(PerfCounters::Get(PerfOp::EVAL_MULT).count, 0u) << "a disabled scope must not be recorded";
+
+    PerfCounters::Enable();
+    auto params = std::make_shared<ILDCRTParams<BigInteger>>(16, 3, 30);
+    DCRTPoly poly(params, Format::EVALUATION, true);
+    {
+        PerfScope keySwitch(PerfOp::KEY_SWITCH);
+        PerfScope mult(PerfOp::EVAL_MULT, 2);
+        poly.SetFormat(Format::COEFFICIENT);
+        DCRTPoly copy(poly);
+        mult.Stop();
+        mult.Stop();
+    }
+    {
+        PerfScope empty(PerfOp::MOD_REDUCE, 0);
+    }
+
+    auto mult = PerfCounters::Get(PerfOp::EVAL_MULT);
+    EXPECT_EQ(mult.count, 2u);
+    EXPECT_EQ(mult.ntts, 3u) << "one inverse NTT per tower";
+    EXPECT_EQ(mult.keySwitches, 0u);
+    EXPECT_EQ(mult.bytesAllocated, 3 * 8 * sizeof(NativeInteger));
+    EXPECT_GE(mult.maxWallTimeNs, mult.wallTimeNs / mult.count);
+
+    auto keySwitch = PerfCounters::Get(PerfOp::KEY_SWITCH);
+    EXPECT_EQ(keySwitch.count, 1u);
+    EXPECT_EQ(keySwitch.keySwitches, 1u);
+    EXPECT_EQ(PerfCounters::GetTotalKeySwitches(), 1u);
+    EXPECT_EQ(PerfCounters::Get(PerfOp::MOD_REDUCE).count, 0u);
+
+    auto snapshot = PerfCounters::GetSnapshot();
+    EXPECT_EQ(snapshot.size(), static_cast<size_t>(PerfOp::NUM_PERF_OPS));
+    EXPECT_EQ(snapshot.at("EvalMult").count, 2u);
+
+    std::string json = PerfCounters::ToJSON();
+    EXPECT_EQ(json.front(), '{');
+    EXPECT_EQ(json.back(), '}');
+    EXPECT_NE(json.find("\"EvalMult\":{\"count\":2,"), std::string::npos);
+    EXPECT_NE(json.find("\"BinFHEBootstrap\""), std::string::npos);
+    EXPECT_NE(json.find("\"threadUtilization\""), std::string::npos);
+
+    PerfCounters::Reset();
+    EXPECT_EQ(PerfCounters::Get(PerfOp::EVAL_MULT).count, 0u);
+    EXPECT_EQ(PerfCounters::GetTotalNTTs(), 0u);
+    PerfCounters::Enable(wasEnabled);
+}
@@ -116,12 +116,10 @@ class CryptoContextImpl : public Serializable {
     void SetKSTechniqueInScheme();
 
     const CryptoContext<Element> GetContextForPointer(const CryptoContextImpl<Element>* cc) const {
-        const auto& contexts = CryptoContextFactory<Element>::GetAllContexts();
-        for (const auto& ctx : contexts) {
-            if (cc == ctx.get())
-                return ctx;
-        }
-        OPENFHE_THROW("Cannot find context for the given pointer to CryptoContextImpl");
+        auto ctx = CryptoContextFactory<Element>::GetContextForPointer(cc);
+        if (ctx == nullptr)
+            OPENFHE_THROW("Cannot find context for the given pointer to CryptoContextImpl");
+        return ctx;
     }
 
     /**
@@ -2643,6 +2641,28 @@ public:
         return GetScheme()->EvalMultMany(ciphertextVec, evalKeyVec);
     }
 
+    /**
+    * @brief Reduces multiple ciphertexts with a user-supplied binary operation using a balanced tree.
+    *        All pairs at the same depth of the tree are evaluated in parallel, and operands at the same
+    *        level are combined first so that deeper ciphertexts are consumed as late as possible.
+    *
+    * @param ciphertextVec  Vector of ciphertexts to reduce.
+    * @param op             Associative and commutative operation, e.g. a multiplication, an addition or
+    *                       a maximum computed via scheme switching.
+    * @param parallel       If true, op is called concurrently for independent pairs and must be thread-safe.
+    * @return Resulting ciphertext.
+    *
+    * @note The operands are reordered by level, so op must not depend on the order of its arguments.
+    */
+    Ciphertext<Element> EvalReduceMany(
+        const std::vector<Ciphertext<Element>>& ciphertextVec,
+        const std::function<Ciphertext<Element>(ConstCiphertext<Element>&, ConstCiphertext<Element>&)>& op,
+        bool parallel = true) const {
+        if (ciphertextVec.empty())
+            OPENFHE_THROW("Empty input ciphertext vector");
+        return GetScheme()->EvalReduceMany(ciphertextVec, op, parallel);
+    }
+
     //------------------------------------------------------------------------------
     // Advanced SHE LINEAR WEIGHTED SUM
     //------------------------------------------------------------------------------
@@ -3337,6 +3357,103 @@ public:
         return GetScheme()->MultiAddEvalMultKeys(evalKey1, evalKey2, keyTag);
     }
 
+    /**
+    * @brief Adds the public keys of all parties at once (Threshold FHE).
+    *
+    * @param publicKeyVec  Public keys of all parties.
+    * @param keyTag        Secret key tag (optional).
+    * @return Combined public key.
+    */
+    PublicKey<Element> MultiAddPubKeys(const std::vector<PublicKey<Element>>& publicKeyVec,
+                                       const std::string& keyTag = "") {
+        for (const auto& publicKey : publicKeyVec) {
+            if (!publicKey)
+                OPENFHE_THROW("Input public key is nullptr");
+        }
+        return GetScheme()->MultiAddPubKeys(publicKeyVec, keyTag);
+    }
+
+    /**
+    * @brief Adds the evaluation keys of all parties at once (Threshold FHE).
+    *        The key components are summed in parallel across digits and parties.
+    *
+    * @param evalKeyVec  Evaluation keys of all parties.
+    * @param keyTag      Secret key tag (optional).
+    * @return Joined evaluation key.
+    */
+    EvalKey<Element> MultiAddEvalKeys(const std::vector<EvalKey<Element>>& evalKeyVec, const std::string& keyTag = "") {
+        for (const auto& evalKey : evalKeyVec) {
+            if (!evalKey)
+                OPENFHE_THROW("Input evaluation key is nullptr");
+        }
+        return GetScheme()->MultiAddEvalKeys(evalKeyVec, keyTag);
+    }
+
+    /**
+    * @brief Adds the partial evaluation keys for multiplication of all parties at once (Threshold FHE).
+    *        The key components are summed in parallel across digits and parties.
+    *
+    * @param evalKeyVec  Partial evaluation keys of all parties.
+    * @param keyTag      Secret key tag (optional).
+    * @return Combined evaluation key.
+    */
+    EvalKey<Element> MultiAddEvalMultKeys(const std::vector<EvalKey<Element>>& evalKeyVec,
+                                          const std::string& keyTag = "") {
+        for (const auto& evalKey : evalKeyVec) {
+            if (!evalKey)
+                OPENFHE_THROW("Input evaluation key is nullptr");
+        }
+        return GetScheme()->MultiAddEvalMultKeys(evalKeyVec, keyTag);
+    }
+
+    /**
+    * @brief Adds the automorphism evaluation key sets of all parties at once (Threshold FHE).
+    *        The keys of all indices are summed in parallel across indices, digits and parties.
+    *
+    * @param evalKeyMapVec  Automorphism key sets of all parties.
+    * @param keyTag         Secret key tag (optional).
+    * @return Combined automorphism evaluation key set with the indices present in every input set.
+    */
+    std::shared_ptr<std::map<uint32_t, EvalKey<Element>>> MultiAddEvalAutomorphismKeys(
+        const std::vector<std::shared_ptr<std::map<uint32_t, EvalKey<Element>>>>& evalKeyMapVec,
+        const std::string& keyTag = "") {
+        for (const auto& evalKeyMap : evalKeyMapVec) {
+            if (!evalKeyMap)
+                OPENFHE_THROW("Input evaluation key map is nullptr");
+        }
+        return GetScheme()->MultiAddEvalAutomorphismKeys(evalKeyMapVec, keyTag);
+    }
+
+    /**
+    * @brief Adds the automorphism evaluation key sets of all parties, reading them one by one from
+    *        serialized files (Threshold FHE). Only the running sum and a single party's key set are
+    *        held in memory at a time.
+    *
+    * @param fileNames  Files with the key sets of all parties, each written with Serial::SerializeToFile
+    *                   from a std::shared_ptr<std::map<uint32_t, EvalKey<Element>>>.
+    * @param sertype    Serialization type of the files.
+    * @param keyTag     Secret key tag (optional).
+    * @return Combined automorphism evaluation key set with the indices present in every input set.
+    */
+    template <typename ST>
+    std::shared_ptr<std::map<uint32_t, EvalKey<Element>>> MultiAddEvalAutomorphismKeysFromFiles(
+        const std::vector<std::string>& fileNames, const ST& sertype, const std::string& keyTag = "") {
+        if (fileNames.empty())
+            OPENFHE_THROW("Input file name vector is empty");
+
+        std::shared_ptr<std::map<uint32_t, EvalKey<Element>>> evalKeyMapSum;
+        for (const auto& fileName : fileNames) {
+            std::shared_ptr<std::map<uint32_t, EvalKey<Element>>> evalKeyMap;
+            if (!Serial::DeserializeFromFile(fileName, evalKeyMap, sertype) || !evalKeyMap)
+                OPENFHE_THROW("Error reading the evaluation key set from " + fileName);
+            if (evalKeyMapSum)
+                evalKeyMapSum = GetScheme()->MultiAddEvalAutomorphismKeys({evalKeyMapSum, evalKeyMap}, keyTag);
+            else
+                evalKeyMapSum = GetScheme()->MultiAddEvalAutomorphismKeys({evalKeyMap}, keyTag);
+        }
+        return evalKeyMapSum;
+    }
+
     /**
     * @brief Performs masked decryption for interactive bootstrapping (2-party protocol).
     *
@@ -3509,11 +3626,56 @@ public:
     * @param correctionFactor Internal rescaling factor to improve precision (only for NATIVE_SIZE=64; 0 = default).
     * @param precompute       Whether to precompute plaintexts for encoding/decoding.
     * @param BTSlotsEncoding  Whether the approximate modular reduction happens over the message being in slots or coefficients
+    * @param compactPrecompute Whether to keep the encoding/decoding plaintexts as slot vectors and encode them during
+    *                          each bootstrapping. Uses a fraction of the memory at the cost of slower bootstrapping.
     */
     void EvalBootstrapSetup(std::vector<uint32_t> levelBudget = {5, 4}, std::vector<uint32_t> dim1 = {0, 0},
                             uint32_t slots = 0, uint32_t correctionFactor = 0, bool precompute = true,
-                            bool BTSlotsEncoding = false) {
-        GetScheme()->EvalBootstrapSetup(*this, levelBudget, dim1, slots, correctionFactor, precompute, BTSlotsEncoding);
+                            bool BTSlotsEncoding = false, bool compactPrecompute = false) {
+        GetScheme()->EvalBootstrapSetup(*this, levelBudget, dim1, slots, correctionFactor, precompute, BTSlotsEncoding,
+                                        compactPrecompute);
+    }
+
+    /**
+    * @brief Sets up bootstrapping for several numbers of slots at once. The baby-step dimensions that are left at 0
+    * are chosen by PlanBootstrapKeySet so that the configurations share rotation keys. Supported only in CKKS.
+    *
+    * @param configs          Bootstrapping configurations, one per number of slots.
+    * @param correctionFactor Same as in the single-configuration EvalBootstrapSetup.
+    * @param precompute       Same as in the single-configuration EvalBootstrapSetup.
+    * @param BTSlotsEncoding  Same as in the single-configuration EvalBootstrapSetup.
+    * @param compactPrecompute Same as in the single-configuration EvalBootstrapSetup.
+    * @return the configurations as they were set up, with every dim1 filled in.
+    */
+    std::vector<CKKSBootstrapConfig> EvalBootstrapSetup(const std::vector<CKKSBootstrapConfig>& configs,
+                                                        uint32_t correctionFactor = 0, bool precompute = true,
+                                                        bool BTSlotsEncoding = false, bool compactPrecompute = false) {
+        auto planned = GetScheme()->PlanBootstrapKeySet(*this, configs);
+        for (const auto& config : planned)
+            GetScheme()->EvalBootstrapSetup(*this, config.levelBudget, config.dim1, config.slots, correctionFactor,
+                                            precompute, BTSlotsEncoding, compactPrecompute);
+        return planned;
+    }
+
+    /**
+    * @brief Chooses the baby-step dimensions of several bootstrapping configurations so that together they need as
+    * few rotation keys as possible. Dimensions set by the caller are kept. Supported only in CKKS.
+    *
+    * @param configs  Bootstrapping configurations, one per number of slots.
+    * @return the configurations with every dim1 filled in, in the order of the input.
+    */
+    std::vector<CKKSBootstrapConfig> PlanBootstrapKeySet(const std::vector<CKKSBootstrapConfig>& configs) const {
+        return GetScheme()->PlanBootstrapKeySet(*this, configs);
+    }
+
+    /**
+    * @brief Returns the rotation indices needed to bootstrap with the given configurations. Supported only in CKKS.
+    *
+    * @param configs  Bootstrapping configurations, one per number of slots.
+    * @return the sorted union of the rotation indices.
+    */
+    std::vector<int32_t> GetBootstrapRotationIndices(const std::vector<CKKSBootstrapConfig>& configs) const {
+        return GetScheme()->GetBootstrapRotationIndices(*this, configs);
     }
 
     /**
@@ -3528,13 +3690,65 @@ public:
         CryptoContextImpl<Element>::InsertEvalAutomorphismKey(evalKeys, privateKey->GetKeyTag());
     }
 
+    /**
+    * @brief Generates automorphism keys for EvalBootstrap at several numbers of slots. A key needed by more than one
+    * of them is generated once. Supported only in CKKS.
+    *
+    * @param privateKey  Secret key.
+    * @param slots       Numbers of slots that were passed to EvalBootstrapSetup.
+    */
+    void EvalBootstrapKeyGen(const PrivateKey<Element> privateKey, const std::vector<uint32_t>& slots) {
+        ValidateKey(privateKey);
+        auto evalKeys = GetScheme()->EvalBootstrapKeyGen(privateKey, slots);
+        CryptoContextImpl<Element>::InsertEvalAutomorphismKey(evalKeys, privateKey->GetKeyTag());
+    }
+
     /**
     * @brief Precomputes plaintexts for encoding and decoding used in bootstrapping. Supported only in CKKS.
     *
+    * @param slots              Number of slots to be bootstrapped.
+    * @param compactPrecompute  Same flag as in EvalBootstrapSetup.
+    */
+    void EvalBootstrapPrecompute(uint32_t slots = 0, bool compactPrecompute = false) {
+        GetScheme()->EvalBootstrapPrecompute(*this, slots, compactPrecompute);
+    }
+
+    /**
+    * @brief Computes the fingerprint identifying the bootstrapping precomputations for this context and the given
+    * bootstrapping configuration. Can be used as the key of a persistent cache. Supported only in CKKS.
+    *
+    * @param levelBudget      Level budgets for encoding and decoding.
+    * @param dim1             Inner dimensions in the baby-step giant-step routine for encoding and decoding.
+    * @param slots            Number of slots to be bootstrapped.
+    * @param BTSlotsEncoding  Same flag as in EvalBootstrapSetup.
+    * @return Hex string of the fingerprint.
+    */
+    std::string GetBootstrapPrecomputeFingerprint(std::vector<uint32_t> levelBudget = {5, 4},
+                                                  std::vector<uint32_t> dim1 = {0, 0}, uint32_t slots = 0,
+                                                  bool BTSlotsEncoding = false) const {
+        return GetScheme()->GetBootstrapPrecomputeFingerprint(*this, levelBudget, dim1, slots, BTSlotsEncoding);
+    }
+
+    /**
+    * @brief Exports the precomputed plaintexts for encoding and decoding used in bootstrapping. The result can be
+    * serialized and later passed to ImportBootstrapPrecompute instead of calling EvalBootstrapSetup with
+    * precompute = true. Supported only in CKKS.
+    *
     * @param slots  Number of slots to be bootstrapped.
+    * @return Serializable bootstrapping precomputations.
+    */
+    std::shared_ptr<CKKSBootstrapPrecomData> ExportBootstrapPrecompute(uint32_t slots = 0) const {
+        return GetScheme()->ExportBootstrapPrecompute(*this, slots);
+    }
+
+    /**
+    * @brief Installs bootstrapping precomputations produced by ExportBootstrapPrecompute. Replaces EvalBootstrapSetup;
+    * the bootstrapping keys still have to be generated or deserialized. Supported only in CKKS.
+    *
+    * @param data  Bootstrapping precomputations. Throws if they were generated for different parameters.
     */
-    void EvalBootstrapPrecompute(uint32_t slots = 0) {
-        GetScheme()->EvalBootstrapPrecompute(*this, slots);
+    void ImportBootstrapPrecompute(const CKKSBootstrapPrecomData& data) {
+        GetScheme()->ImportBootstrapPrecompute(*this, data);
     }
 
     /**
@@ -3550,6 +3764,24 @@ public:
         return GetScheme()->EvalBootstrap(ciphertext, numIterations, precision);
     }
 
+    /**
+    * @brief Evaluates bootstrapping on a batch of ciphertexts. Supported only in CKKS.
+    *
+    * The ciphertexts go through modulus raising, CoeffsToSlots, approximate modular reduction and SlotsToCoeffs
+    * together, so every rotation key and linear-transform plaintext is used once per batch rather than once per
+    * ciphertext, and the per-ciphertext work runs in parallel. Prefer it over repeated EvalBootstrap calls when
+    * throughput matters more than the latency of a single ciphertext.
+    *
+    * @param ciphertexts    Input ciphertexts. All must have the same number of slots and key tag.
+    * @param numIterations  Number of Meta-BTS iterations to improve precision.
+    * @param precision      Initial bootstrapping precision (set to 0 for default; tune experimentally).
+    * @return Refreshed ciphertexts, in the order of the input.
+    */
+    std::vector<Ciphertext<Element>> EvalBootstrapBatch(const std::vector<Ciphertext<Element>>& ciphertexts,
+                                                        uint32_t numIterations = 1, uint32_t precision = 0) const {
+        return GetScheme()->EvalBootstrapBatch(ciphertexts, numIterations, precision);
+    }
+
     Ciphertext<Element> EvalBootstrapStCFirst(ConstCiphertext<Element>& ciphertext, uint32_t numIterations = 1,
                                               uint32_t precision = 0) const {
         return GetScheme()->EvalBootstrapStCFirst(ciphertext, numIterations, precision);
@@ -37,7 +37,9 @@
 #include "scheme/scheme-id.h"
 
 #include <memory>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace lbcrypto {
@@ -50,44 +52,78 @@ class CryptoParametersBase;
 /**
  * @brief CryptoContextFactory
  *
- * A class that contains all generated contexts and static methods to access/release them
+ * A class that contains all generated contexts and static methods to access/release them.
+ * The contexts are indexed by a fingerprint of their crypto parameters and by the address of their implementation,
+ * so lookups do not scan all contexts. All methods are thread-safe: lookups take a shared lock and only adding or
+ * releasing contexts takes an exclusive one.
  */
 template <typename Element>
 class CryptoContextFactory {
     static std::vector<CryptoContext<Element>> AllContexts;
+    static std::unordered_multimap<size_t, CryptoContext<Element>> ContextsByFingerprint;
+    static std::unordered_map<const CryptoContextImpl<Element>*, CryptoContext<Element>> ContextsByPointer;
+    static std::shared_mutex ContextsMutex;
+
+    // the callers of the functions below must hold ContextsMutex
+    static CryptoContext<Element> FindContextLocked(size_t fingerprint,
+                                                    const std::shared_ptr<CryptoParametersBase<Element>>& params,
+                                                    const std::shared_ptr<SchemeBase<Element>>& scheme);
+    static void AddContextLocked(size_t fingerprint, const CryptoContext<Element>& cc);
 
 protected:
+    /**
+     * @brief Computes a hash of the crypto parameters. Parameter objects that compare equal have the same fingerprint
+     * @param params crypto parameters
+     * @return the fingerprint
+     */
+    static size_t GetFingerprint(const CryptoParametersBase<Element>& params);
+
     static CryptoContext<Element> FindContext(std::shared_ptr<CryptoParametersBase<Element>> params,
                                               std::shared_ptr<SchemeBase<Element>> scheme);
     static void AddContext(CryptoContext<Element>);
 
 public:
-    static void ReleaseAllContexts() {
-        if (AllContexts.size() > 0)
-            AllContexts[0]->ClearStaticMapsAndVectors();
-        AllContexts.clear();
-    }
+    static void ReleaseAllContexts();
 
-    static int GetContextCount() {
-        return AllContexts.size();
-    }
+    /**
+     * @brief Removes a single context from the factory and clears the evaluation keys generated for it.
+     * The context itself is destroyed once the last reference to it is dropped
+     * @param cc the context to release
+     * @return true if the context was found in the factory
+     */
+    static bool ReleaseContext(const CryptoContext<Element>& cc);
+
+    static int GetContextCount();
 
     static CryptoContext<Element> GetContext(std::shared_ptr<CryptoParametersBase<Element>> params,
                                              std::shared_ptr<SchemeBase<Element>> scheme,
                                              SCHEME schemeId = SCHEME::INVALID_SCHEME);
 
+    /**
+     * @brief Finds the context owning the given implementation object
+     * @param cc pointer to the implementation
+     * @return the context or nullptr if it is not in the factory
+     */
+    static CryptoContext<Element> GetContextForPointer(const CryptoContextImpl<Element>* cc);
+
     // GetFullContextByDeserializedContext() is to get the full cryptocontext based on partial information
     // we usually get from a de-serialized cryptocontext object. Using this function instead of GetContext()
     // allows to avoid circular dependencies in some places by including cryptocontext-fwd.h
     static CryptoContext<Element> GetFullContextByDeserializedContext(const CryptoContext<Element> context);
 
-    static const std::vector<CryptoContext<Element>>& GetAllContexts() {
-        return AllContexts;
-    }
+    // returns a snapshot, so the result stays valid while other threads add or release contexts
+    static std::vector<CryptoContext<Element>> GetAllContexts();
 };
 
 template <>
 std::vector<CryptoContext<DCRTPoly>> CryptoContextFactory<DCRTPoly>::AllContexts;
+template <>
+std::unordered_multimap<size_t, CryptoContext<DCRTPoly>> CryptoContextFactory<DCRTPoly>::ContextsByFingerprint;
+template <>
+std::unordered_map<const CryptoContextImpl<DCRTPoly>*, CryptoContext<DCRTPoly>>
+    CryptoContextFactory<DCRTPoly>::ContextsByPointer;
+template <>
+std::shared_mutex CryptoContextFactory<DCRTPoly>::ContextsMutex;
 
 }  // namespace lbcrypto
 
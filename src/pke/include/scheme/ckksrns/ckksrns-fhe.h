@@ -100,6 +100,10 @@ public:
     // flag indicating whether we perform StC before ModRaise
     bool BTSlotsEncoding;
 
+    // flag indicating whether the CoeffsToSlots/SlotsToCoeffs plaintexts are stored as slot vectors and encoded
+    // just before they are used (smaller memory footprint at the cost of re-encoding in every bootstrapping)
+    bool m_compactPrecompute{false};
+
     template <class Archive>
     void save(Archive& ar) const {
         ar(cereal::make_nvp("dim1_Enc", m_paramsEnc.g));
@@ -121,6 +125,111 @@ public:
     }
 };
 
+/**
+ * @brief Serializable snapshot of the bootstrapping precomputations for one number of slots.
+ *
+ * The CoeffsToSlots/SlotsToCoeffs plaintexts are kept as their EVALUATION-format elements together with the
+ * encoding metadata needed to rebuild them, so the tables can be loaded instead of being recomputed by
+ * EvalBootstrapSetup/EvalBootstrapPrecompute. The fingerprint is a hash of the crypto parameters, the level
+ * budgets, the baby-step dimensions and the number of slots; tables are only accepted by a context with the
+ * same fingerprint.
+ */
+class CKKSBootstrapPrecomData : public Serializable {
+public:
+    // element and encoding metadata of one precomputed plaintext; entries of the baby-step giant-step grid
+    // that are never used are stored with isSet = false
+    struct PlaintextData {
+        DCRTPoly element;
+        double scalingFactor{1.0};
+        uint32_t level{0};
+        uint32_t noiseScaleDeg{1};
+        uint32_t slots{0};
+        bool isSet{false};
+
+        template <class Archive>
+        void save(Archive& ar) const {
+            ar(cereal::make_nvp("set", isSet));
+            if (isSet) {
+                ar(cereal::make_nvp("e", element));
+                ar(cereal::make_nvp("sf", scalingFactor));
+                ar(cereal::make_nvp("l", level));
+                ar(cereal::make_nvp("d", noiseScaleDeg));
+                ar(cereal::make_nvp("s", slots));
+            }
+        }
+
+        template <class Archive>
+        void load(Archive& ar) {
+            ar(cereal::make_nvp("set", isSet));
+            if (isSet) {
+                ar(cereal::make_nvp("e", element));
+                ar(cereal::make_nvp("sf", scalingFactor));
+                ar(cereal::make_nvp("l", level));
+                ar(cereal::make_nvp("d", noiseScaleDeg));
+                ar(cereal::make_nvp("s", slots));
+            }
+        }
+    };
+
+    std::string m_fingerprint;
+
+    uint32_t m_slots{0};
+    uint32_t m_correctionFactor{0};
+    uint32_t m_lvlbEnc{0};
+    uint32_t m_lvlbDec{0};
+    uint32_t m_gEnc{0};
+    uint32_t m_gDec{0};
+    bool m_BTSlotsEncoding{false};
+
+    std::vector<PlaintextData> m_U0Pre;
+    std::vector<PlaintextData> m_U0hatTPre;
+    std::vector<std::vector<PlaintextData>> m_U0PreFFT;
+    std::vector<std::vector<PlaintextData>> m_U0hatTPreFFT;
+
+    template <class Archive>
+    void save(Archive& ar, std::uint32_t const version) const {
+        ar(cereal::make_nvp("fp", m_fingerprint));
+        ar(cereal::make_nvp("slots", m_slots));
+        ar(cereal::make_nvp("corFactor", m_correctionFactor));
+        ar(cereal::make_nvp("lEnc", m_lvlbEnc));
+        ar(cereal::make_nvp("lDec", m_lvlbDec));
+        ar(cereal::make_nvp("dim1_Enc", m_gEnc));
+        ar(cereal::make_nvp("dim1_Dec", m_gDec));
+        ar(cereal::make_nvp("BTSlotsEncoding", m_BTSlotsEncoding));
+        ar(cereal::make_nvp("U0", m_U0Pre));
+        ar(cereal::make_nvp("U0hatT", m_U0hatTPre));
+        ar(cereal::make_nvp("U0FFT", m_U0PreFFT));
+        ar(cereal::make_nvp("U0hatTFFT", m_U0hatTPreFFT));
+    }
+
+    template <class Archive>
+    void load(Archive& ar, std::uint32_t const version) {
+        if (version > SerializedVersion()) {
+            OPENFHE_THROW("serialized object version " + std::to_string(version) +
+                          " is from a later version of the library");
+        }
+        ar(cereal::make_nvp("fp", m_fingerprint));
+        ar(cereal::make_nvp("slots", m_slots));
+        ar(cereal::make_nvp("corFactor", m_correctionFactor));
+        ar(cereal::make_nvp("lEnc", m_lvlbEnc));
+        ar(cereal::make_nvp("lDec", m_lvlbDec));
+        ar(cereal::make_nvp("dim1_Enc", m_gEnc));
+        ar(cereal::make_nvp("dim1_Dec", m_gDec));
+        ar(cereal::make_nvp("BTSlotsEncoding", m_BTSlotsEncoding));
+        ar(cereal::make_nvp("U0", m_U0Pre));
+        ar(cereal::make_nvp("U0hatT", m_U0hatTPre));
+        ar(cereal::make_nvp("U0FFT", m_U0PreFFT));
+        ar(cereal::make_nvp("U0hatTFFT", m_U0hatTPreFFT));
+    }
+
+    std::string SerializedObjectName() const override {
+        return "CKKSBootstrapPrecomData";
+    }
+    static uint32_t SerializedVersion() {
+        return 1;
+    }
+};
+
 using namespace std::literals::complex_literals;
 
 class FHECKKSRNS : public FHERNS {
@@ -145,16 +254,39 @@ public:
 
     void EvalBootstrapSetup(const CryptoContextImpl<DCRTPoly>& cc, std::vector<uint32_t> levelBudget,
                             std::vector<uint32_t> dim1, uint32_t slots, uint32_t correctionFactor, bool precompute,
-                            bool BTSlotsEncoding) override;
+                            bool BTSlotsEncoding, bool compactPrecompute) override;
 
     std::shared_ptr<std::map<uint32_t, EvalKey<DCRTPoly>>> EvalBootstrapKeyGen(const PrivateKey<DCRTPoly> privateKey,
                                                                                uint32_t slots) override;
 
-    void EvalBootstrapPrecompute(const CryptoContextImpl<DCRTPoly>& cc, uint32_t slots) override;
+    std::shared_ptr<std::map<uint32_t, EvalKey<DCRTPoly>>> EvalBootstrapKeyGen(
+        const PrivateKey<DCRTPoly> privateKey, const std::vector<uint32_t>& slots) override;
+
+    std::vector<CKKSBootstrapConfig> PlanBootstrapKeySet(
+        const CryptoContextImpl<DCRTPoly>& cc, const std::vector<CKKSBootstrapConfig>& configs) const override;
+
+    std::vector<int32_t> GetBootstrapRotationIndices(const CryptoContextImpl<DCRTPoly>& cc,
+                                                     const std::vector<CKKSBootstrapConfig>& configs) const override;
+
+    void EvalBootstrapPrecompute(const CryptoContextImpl<DCRTPoly>& cc, uint32_t slots,
+                                 bool compactPrecompute) override;
+
+    std::string GetBootstrapPrecomputeFingerprint(const CryptoContextImpl<DCRTPoly>& cc,
+                                                  std::vector<uint32_t> levelBudget, std::vector<uint32_t> dim1,
+                                                  uint32_t slots, bool BTSlotsEncoding) const override;
+
+    std::shared_ptr<CKKSBootstrapPrecomData> ExportBootstrapPrecompute(const CryptoContextImpl<DCRTPoly>& cc,
+                                                                       uint32_t slots) const override;
+
+    void ImportBootstrapPrecompute(const CryptoContextImpl<DCRTPoly>& cc,
+                                   const CKKSBootstrapPrecomData& data) override;
 
     Ciphertext<DCRTPoly> EvalBootstrap(ConstCiphertext<DCRTPoly>& ciphertext, uint32_t numIterations,
                                        uint32_t precision) const override;
 
+    std::vector<Ciphertext<DCRTPoly>> EvalBootstrapBatch(const std::vector<Ciphertext<DCRTPoly>>& ciphertexts,
+                                                         uint32_t numIterations, uint32_t precision) const override;
+
     Ciphertext<DCRTPoly> EvalBootstrapStCFirst(ConstCiphertext<DCRTPoly>& ciphertext, uint32_t numIterations,
                                                uint32_t precision) const override;
 
@@ -260,6 +392,19 @@ public:
     Ciphertext<DCRTPoly> EvalSlotsToCoeffs(const std::vector<std::vector<ReadOnlyPlaintext>>& A,
                                            ConstCiphertext<DCRTPoly>& ctxt) const;
 
+    // The batch variants apply the same transform to every ciphertext of the batch: the plaintexts of each giant
+    // step are encoded once and every rotation key is used for all ciphertexts before moving on to the next one.
+    std::vector<Ciphertext<DCRTPoly>> EvalLinearTransformBatch(
+        const std::vector<ReadOnlyPlaintext>& A, const std::vector<ReadOnlyCiphertext<DCRTPoly>>& cts) const;
+
+    std::vector<Ciphertext<DCRTPoly>> EvalCoeffsToSlotsBatch(
+        const std::vector<std::vector<ReadOnlyPlaintext>>& A,
+        const std::vector<ReadOnlyCiphertext<DCRTPoly>>& ctxts) const;
+
+    std::vector<Ciphertext<DCRTPoly>> EvalSlotsToCoeffsBatch(
+        const std::vector<std::vector<ReadOnlyPlaintext>>& A,
+        const std::vector<ReadOnlyCiphertext<DCRTPoly>>& ctxts) const;
+
     //------------------------------------------------------------------------------
     // SERIALIZATION
     //------------------------------------------------------------------------------
@@ -316,6 +461,24 @@ public:
                                       const std::vector<std::complex<double>>& value, size_t noiseScaleDeg,
                                       uint32_t level, uint32_t slots);
 
+    /**
+     * Same arguments as MakeAuxPlaintext, but the plaintext only keeps the slot values and the encoding metadata.
+     * It has to be passed through EncodeAuxPlaintexts before it can be used in EvalMultExt.
+     */
+    static Plaintext MakeCompactAuxPlaintext(const CryptoContextImpl<DCRTPoly>& cc,
+                                             const std::shared_ptr<ParmType> params,
+                                             const std::vector<std::complex<double>>& value, size_t noiseScaleDeg,
+                                             uint32_t level, uint32_t slots);
+
+    /**
+     * Returns the plaintexts A[start], ..., A[start + count - 1] ready to be used in EvalMultExt. Plaintexts created
+     * by MakeCompactAuxPlaintext are encoded (in parallel); the others are returned as they are. Missing entries and
+     * indices past the end of A are returned as nullptr.
+     */
+    static std::vector<ReadOnlyPlaintext> EncodeAuxPlaintexts(const CryptoContextImpl<DCRTPoly>& cc,
+                                                              const std::vector<ReadOnlyPlaintext>& A, uint32_t start,
+                                                              uint32_t count);
+
     static Ciphertext<DCRTPoly> EvalMultExt(ConstCiphertext<DCRTPoly> ciphertext, ConstPlaintext plaintext);
 
     static void EvalAddExtInPlace(Ciphertext<DCRTPoly>& ciphertext1, ConstCiphertext<DCRTPoly> ciphertext2);
@@ -340,13 +503,22 @@ private:
     // Find Rotation Indices
     //------------------------------------------------------------------------------
     std::vector<int32_t> FindBootstrapRotationIndices(uint32_t slots, uint32_t M);
+    static std::vector<int32_t> FindBootstrapRotationIndices(uint32_t slots, uint32_t M,
+                                                             const ckks_boot_params& paramsEnc,
+                                                             const ckks_boot_params& paramsDec);
 
     // ATTN: The following 3 functions are helper methods to be called in FindBootstrapRotationIndices() only.
     // so they DO NOT remove possible duplicates and automorphisms corresponding to 0 and M/4.
     // These methods completely depend on FindBootstrapRotationIndices() to do that.
-    std::vector<uint32_t> FindLinearTransformRotationIndices(uint32_t slots, uint32_t M);
-    std::vector<uint32_t> FindCoeffsToSlotsRotationIndices(uint32_t slots, uint32_t M);
-    std::vector<uint32_t> FindSlotsToCoeffsRotationIndices(uint32_t slots, uint32_t M);
+    static std::vector<uint32_t> FindLinearTransformRotationIndices(uint32_t slots, uint32_t M,
+                                                                    const ckks_boot_params& p);
+    static std::vector<uint32_t> FindCoeffsToSlotsRotationIndices(uint32_t slots, uint32_t M,
+                                                                  const ckks_boot_params& p);
+    static std::vector<uint32_t> FindSlotsToCoeffsRotationIndices(uint32_t slots, uint32_t M,
+                                                                  const ckks_boot_params& p);
+
+    // bootstrapping FFT parameters of a configuration, with the level budgets adjusted as in EvalBootstrapSetup
+    static std::pair<ckks_boot_params, ckks_boot_params> GetBootstrapFFTParams(const CKKSBootstrapConfig& config);
 
     //------------------------------------------------------------------------------
     // Auxiliary Bootstrap Functions
@@ -364,6 +536,10 @@ private:
 
     void ApplyDoubleAngleIterations(Ciphertext<DCRTPoly>& ciphertext, uint32_t numIt) const;
 
+    // single-iteration bootstrapping of ciphertexts that share the number of slots and the key tag
+    std::vector<Ciphertext<DCRTPoly>> EvalBootstrapInternal(
+        const std::vector<ReadOnlyCiphertext<DCRTPoly>>& ciphertexts) const;
+
     /**
    * Set modulus and recalculates the vector values to fit the modulus
    *
@@ -49,4 +49,6 @@ CEREAL_REGISTER_POLYMORPHIC_RELATION(lbcrypto::CryptoParametersRNS, lbcrypto::Cr
 CEREAL_REGISTER_POLYMORPHIC_RELATION(lbcrypto::FHERNS, lbcrypto::FHECKKSRNS);
 CEREAL_REGISTER_POLYMORPHIC_RELATION(lbcrypto::FHERNS, lbcrypto::SWITCHCKKSRNS);
 
+CEREAL_CLASS_VERSION(lbcrypto::CKKSBootstrapPrecomData, lbcrypto::CKKSBootstrapPrecomData::SerializedVersion());
+
 #endif  // __CKKSRNS_SER_H__
@@ -276,6 +276,17 @@ struct ckks_boot_params {
 };
 struct ckks_boot_params GetCollapsedFFTParams(uint32_t slots, uint32_t levelBudget = 4, uint32_t dim1 = 0);
 
+/**
+ * Bootstrapping configuration for one number of slots, as passed to EvalBootstrapSetup. A deployment that
+ * bootstraps at several slot counts describes all of them to the key-set planner, which picks dim1 so that
+ * the configurations share as many rotation keys as possible.
+ */
+struct CKKSBootstrapConfig {
+    uint32_t slots{0};                          // number of slots; 0 stands for fully packed
+    std::vector<uint32_t> levelBudget{5, 4};    // level budgets for encoding and decoding
+    std::vector<uint32_t> dim1{0, 0};           // baby steps for encoding and decoding; 0 lets the planner choose
+};
+
 /**
  *  Gets inner loop dimension for baby step giant step algorithm for linear transform,
  * taking into account the cost efficiency of hoisted automorphisms.
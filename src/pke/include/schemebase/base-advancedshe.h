@@ -41,6 +41,7 @@
 #include "utils/inttypes.h"
 
 #include <complex>
+#include <functional>
 #include <map>
 #include <memory>
 #include <set>
@@ -99,6 +100,22 @@ public:
     virtual Ciphertext<Element> EvalMultMany(const std::vector<Ciphertext<Element>>& ciphertextVec,
                                              const std::vector<EvalKey<Element>>& evalKeyVec) const;
 
+    /**
+   * Reduces a list of ciphertexts with a binary operation using a balanced tree.
+   * All pairs at the same depth of the tree are evaluated in parallel. The operands
+   * are ordered by level, so ciphertexts at the same level are combined first and
+   * deeper ciphertexts wait until the others reach their level.
+   *
+   * @param ciphertextVec is the ciphertext list.
+   * @param op associative and commutative operation applied to pairs of ciphertexts.
+   * @param parallel if true, op is called concurrently for independent pairs and must be thread-safe.
+   * @return the reduced ciphertext.
+   */
+    Ciphertext<Element> EvalReduceMany(
+        const std::vector<Ciphertext<Element>>& ciphertextVec,
+        const std::function<Ciphertext<Element>(ConstCiphertext<Element>&, ConstCiphertext<Element>&)>& op,
+        bool parallel = true) const;
+
     //------------------------------------------------------------------------------
     // LINEAR WEIGHTED SUM
     //------------------------------------------------------------------------------
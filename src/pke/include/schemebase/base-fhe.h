@@ -38,6 +38,7 @@
 #include "key/evalkey-fwd.h"
 #include "key/keypair.h"
 #include "key/privatekey-fwd.h"
+#include "scheme/ckksrns/ckksrns-utils.h"
 #include "scheme/scheme-swch-params.h"
 #include "utils/exception.h"
 
@@ -53,6 +54,8 @@
  */
 namespace lbcrypto {
 
+class CKKSBootstrapPrecomData;
+
 /**
  * @brief Abstract interface class for LBC PRE algorithms
  * @tparam Element a ring element.
@@ -87,10 +90,11 @@ public:
    * @param correctionFactor - value to rescale message by to improve precision. If set to 0, we use the default logic. This value is only used when NATIVE_SIZE=64
    * @param precompute - flag specifying whether to precompute the plaintexts for encoding and decoding.
    * @param BTSlotsEncoding - flag specifying whether the approximate modular reduction happens over the message being in slots or coefficients.
+   * @param compactPrecompute - flag specifying whether the plaintexts for encoding and decoding are stored as slot vectors and encoded when they are used.
    */
     virtual void EvalBootstrapSetup(const CryptoContextImpl<Element>& cc, std::vector<uint32_t> levelBudget,
                                     std::vector<uint32_t> dim1, uint32_t slots, uint32_t correctionFactor,
-                                    bool precompute, bool BTSlotsEncoding) {
+                                    bool precompute, bool BTSlotsEncoding, bool compactPrecompute) {
         OPENFHE_THROW(NOT_SUPPORTED_SIMPLE_ERROR);
     }
 
@@ -107,12 +111,89 @@ public:
         OPENFHE_THROW(NOT_SUPPORTED_SIMPLE_ERROR);
     }
 
+    /**
+   * Generates the automorphism keys for bootstrapping at several numbers of slots. Each key shared by the
+   * configurations is generated once. Supported in CKKS only.
+   *
+   * @param privateKey private key.
+   * @param slots - numbers of slots to be bootstrapped; EvalBootstrapSetup must have been called for each of them
+   * @return the dictionary of evaluation key indices.
+   */
+    virtual std::shared_ptr<std::map<uint32_t, EvalKey<Element>>> EvalBootstrapKeyGen(
+        const PrivateKey<Element> privateKey, const std::vector<uint32_t>& slots) {
+        OPENFHE_THROW(NOT_SUPPORTED_SIMPLE_ERROR);
+    }
+
+    /**
+   * Chooses the baby-step dimensions of several bootstrapping configurations so that together they need as
+   * few rotation keys as possible. Dimensions set by the caller (nonzero dim1) are kept. Supported in CKKS only.
+   *
+   * @param configs - bootstrapping configurations, one per number of slots
+   * @return the configurations with every dim1 filled in, in the order of the input
+   */
+    virtual std::vector<CKKSBootstrapConfig> PlanBootstrapKeySet(
+        const CryptoContextImpl<Element>& cc, const std::vector<CKKSBootstrapConfig>& configs) const {
+        OPENFHE_THROW(NOT_SUPPORTED_SIMPLE_ERROR);
+    }
+
+    /**
+   * Returns the rotation indices needed to bootstrap with all of the given configurations. The conjugation key
+   * and the keys for sparse secret encapsulation are not rotations and are not included. Supported in CKKS only.
+   *
+   * @param configs - bootstrapping configurations, one per number of slots
+   * @return the sorted union of the rotation indices
+   */
+    virtual std::vector<int32_t> GetBootstrapRotationIndices(const CryptoContextImpl<Element>& cc,
+                                                             const std::vector<CKKSBootstrapConfig>& configs) const {
+        OPENFHE_THROW(NOT_SUPPORTED_SIMPLE_ERROR);
+    }
+
     /**
    * Computes the plaintexts for encoding and decoding for both linear and FFT-like methods. Supported in CKKS only.
    *
    * @param slots - number of slots to be bootstrapped
+   * @param compactPrecompute - flag specifying whether the plaintexts are stored as slot vectors and encoded when they are used.
+   */
+    virtual void EvalBootstrapPrecompute(const CryptoContextImpl<Element>& cc, uint32_t slots,
+                                         bool compactPrecompute) {
+        OPENFHE_THROW(NOT_SUPPORTED_SIMPLE_ERROR);
+    }
+
+    /**
+   * Computes the fingerprint that identifies the bootstrapping precomputations for the given crypto context
+   * and bootstrapping configuration. Supported in CKKS only.
+   *
+   * @param levelBudget - vector of budgets for the amount of levels in encoding and decoding
+   * @param dim1 - vector of inner dimension in the baby-step giant-step routine for encoding and decoding
+   * @param slots - number of slots to be bootstrapped
+   * @param BTSlotsEncoding - flag specifying whether the approximate modular reduction happens over the message being in slots or coefficients.
+   * @return the fingerprint as a hex string
+   */
+    virtual std::string GetBootstrapPrecomputeFingerprint(const CryptoContextImpl<Element>& cc,
+                                                          std::vector<uint32_t> levelBudget,
+                                                          std::vector<uint32_t> dim1, uint32_t slots,
+                                                          bool BTSlotsEncoding) const {
+        OPENFHE_THROW(NOT_SUPPORTED_SIMPLE_ERROR);
+    }
+
+    /**
+   * Exports the precomputed plaintexts for encoding and decoding so they can be serialized. Supported in CKKS only.
+   *
+   * @param slots - number of slots to be bootstrapped
+   * @return the serializable bootstrapping precomputations
+   */
+    virtual std::shared_ptr<CKKSBootstrapPrecomData> ExportBootstrapPrecompute(const CryptoContextImpl<Element>& cc,
+                                                                               uint32_t slots) const {
+        OPENFHE_THROW(NOT_SUPPORTED_SIMPLE_ERROR);
+    }
+
+    /**
+   * Installs previously exported bootstrapping precomputations. Replaces EvalBootstrapSetup with precompute = true
+   * for the same configuration. Supported in CKKS only.
+   *
+   * @param data - bootstrapping precomputations; their fingerprint must match the crypto context
    */
-    virtual void EvalBootstrapPrecompute(const CryptoContextImpl<Element>& cc, uint32_t slots) {
+    virtual void ImportBootstrapPrecompute(const CryptoContextImpl<Element>& cc, const CKKSBootstrapPrecomData& data) {
         OPENFHE_THROW(NOT_SUPPORTED_SIMPLE_ERROR);
     }
 
@@ -136,6 +217,20 @@ public:
         OPENFHE_THROW(NOT_IMPLEMENTED_ERROR);
     }
 
+  /**
+   * Bootstraps a batch of ciphertexts. The ciphertexts advance through every bootstrapping stage together so
+   * that each rotation key and each precomputed plaintext is used for the whole batch at once.
+   *
+   * @param ciphertexts the input ciphertexts; all must have the same number of slots and key tag.
+   * @param numIterations number of iterations to run iterative bootstrapping (Meta-BTS).
+   * @param precision precision of initial bootstrapping algorithm.
+   * @return the refreshed ciphertexts, in the order of the input.
+   */
+    virtual std::vector<Ciphertext<Element>> EvalBootstrapBatch(const std::vector<Ciphertext<Element>>& ciphertexts,
+                                                                uint32_t numIterations, uint32_t precision) const {
+        OPENFHE_THROW(NOT_IMPLEMENTED_ERROR);
+    }
+
     virtual Ciphertext<Element> EvalBootstrapStCFirst(ConstCiphertext<Element>& ciphertext, uint32_t numIterations,
                                                       uint32_t precision) const {
         OPENFHE_THROW(NOT_SUPPORTED_SIMPLE_ERROR);
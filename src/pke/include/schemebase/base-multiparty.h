@@ -40,6 +40,7 @@
 #include "key/publickey-fwd.h"
 #include "scheme/ckksrns/ckksrns-cryptoparameters.h"
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -283,6 +284,40 @@ public:
         const std::shared_ptr<std::map<usint, EvalKey<Element>>> evalKeyMap1,
         const std::shared_ptr<std::map<usint, EvalKey<Element>>> evalKeyMap2) const;
 
+    /**
+   * Threshold FHE: Adds the public keys of all parties at once
+   *
+   * @param publicKeyVec public keys of all parties.
+   * @return the new joined key.
+   */
+    virtual PublicKey<Element> MultiAddPubKeys(const std::vector<PublicKey<Element>>& publicKeyVec) const;
+
+    /**
+   * Threshold FHE: Adds the evaluation keys of all parties at once
+   *
+   * @param evalKeyVec evaluation keys of all parties.
+   * @return the new joined key.
+   */
+    virtual EvalKey<Element> MultiAddEvalKeys(const std::vector<EvalKey<Element>>& evalKeyVec) const;
+
+    /**
+   * Threshold FHE: Adds the partial evaluation keys for multiplication of all parties at once
+   *
+   * @param evalKeyVec partial evaluation keys of all parties.
+   * @return the new joined key.
+   */
+    virtual EvalKey<Element> MultiAddEvalMultKeys(const std::vector<EvalKey<Element>>& evalKeyVec) const;
+
+    /**
+    * Threshold FHE: Adds the evaluation key sets for automorphisms of all parties at once.
+    * Only the indices present in every key set are joined.
+    *
+    * @param evalKeyMapVec automorphism key sets of all parties.
+    * @return the new joined key set.
+    */
+    virtual std::shared_ptr<std::map<usint, EvalKey<Element>>> MultiAddEvalAutomorphismKeys(
+        const std::vector<std::shared_ptr<std::map<usint, EvalKey<Element>>>>& evalKeyMapVec) const;
+
     /**
 	 * Prepare a ciphertext for interactive bootstraping.
 	 *
@@ -429,6 +464,29 @@ public:
     std::string SerializedObjectName() const {
         return "MultiPartyBase";
     }
+
+protected:
+    /**
+    * Sums the contributions of all parties position by position. The parties are split into
+    * groups that are accumulated in parallel, and the group sums are added in a balanced tree.
+    * The number of groups is chosen so that all threads are busy even for few positions.
+    *
+    * @param numParties number of parties.
+    * @param numItems number of positions (e.g., key digits) contributed by each party.
+    * @param contribution returns the element of a given party at a given position.
+    * @return the sums for all positions.
+    */
+    static std::vector<Element> SumAcrossParties(
+        uint32_t numParties, uint32_t numItems,
+        const std::function<const Element&(uint32_t party, uint32_t item)>& contribution);
+
+    /**
+    * Sums the first elements of the partial decryptions of all parties.
+    *
+    * @param ciphertextVec vector of "partial" decryptions.
+    * @return the sum of the partial decryptions.
+    */
+    static Element SumPartialDecryptions(const std::vector<Ciphertext<Element>>& ciphertextVec);
 };
 
 }  // namespace lbcrypto
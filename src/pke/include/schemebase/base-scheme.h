@@ -46,6 +46,7 @@
 #include "schemebase/base-pre.h"
 #include "utils/caller_info.h"
 #include "utils/exception.h"
+#include "utils/profiler.h"
 
 #include <map>
 #include <memory>
@@ -491,22 +492,26 @@ public:
     virtual Ciphertext<Element> EvalMult(ConstCiphertext<Element>& ciphertext1,
                                          ConstCiphertext<Element>& ciphertext2) const {
         VerifyLeveledSHEEnabled(__func__);
+        PerfScope perfScope(PerfOp::EVAL_MULT);
         return m_LeveledSHE->EvalMult(ciphertext1, ciphertext2);
     }
 
     virtual Ciphertext<Element> EvalMultMutable(Ciphertext<Element>& ciphertext1,
                                                 Ciphertext<Element>& ciphertext2) const {
         VerifyLeveledSHEEnabled(__func__);
+        PerfScope perfScope(PerfOp::EVAL_MULT);
         return m_LeveledSHE->EvalMultMutable(ciphertext1, ciphertext2);
     }
 
     virtual Ciphertext<Element> EvalSquare(ConstCiphertext<Element>& ciphertext) const {
         VerifyLeveledSHEEnabled(__func__);
+        PerfScope perfScope(PerfOp::EVAL_MULT);
         return m_LeveledSHE->EvalSquare(ciphertext);
     }
 
     virtual Ciphertext<Element> EvalSquareMutable(Ciphertext<Element>& ciphertext) const {
         VerifyLeveledSHEEnabled(__func__);
+        PerfScope perfScope(PerfOp::EVAL_MULT);
         return m_LeveledSHE->EvalSquareMutable(ciphertext);
     }
 
@@ -517,40 +522,47 @@ public:
     virtual Ciphertext<Element> EvalMult(ConstCiphertext<Element>& ciphertext1, ConstCiphertext<Element>& ciphertext2,
                                          const EvalKey<Element> evalKey) const {
         VerifyLeveledSHEEnabled(__func__);
+        PerfScope perfScope(PerfOp::EVAL_MULT);
         return m_LeveledSHE->EvalMult(ciphertext1, ciphertext2, evalKey);
     }
 
     virtual void EvalMultInPlace(Ciphertext<Element>& ciphertext1, ConstCiphertext<Element>& ciphertext2,
                                  const EvalKey<Element> evalKey) const {
         VerifyLeveledSHEEnabled(__func__);
+        PerfScope perfScope(PerfOp::EVAL_MULT);
         m_LeveledSHE->EvalMultInPlace(ciphertext1, ciphertext2, evalKey);
     }
 
     virtual Ciphertext<Element> EvalMultMutable(Ciphertext<Element>& ciphertext1, Ciphertext<Element>& ciphertext2,
                                                 const EvalKey<Element> evalKey) const {
         VerifyLeveledSHEEnabled(__func__);
+        PerfScope perfScope(PerfOp::EVAL_MULT);
         return m_LeveledSHE->EvalMultMutable(ciphertext1, ciphertext2, evalKey);
     }
 
     virtual void EvalMultMutableInPlace(Ciphertext<Element>& ciphertext1, Ciphertext<Element>& ciphertext2,
                                         const EvalKey<Element> evalKey) const {
         VerifyLeveledSHEEnabled(__func__);
+        PerfScope perfScope(PerfOp::EVAL_MULT);
         m_LeveledSHE->EvalMultMutableInPlace(ciphertext1, ciphertext2, evalKey);
     }
 
     virtual Ciphertext<Element> EvalSquare(ConstCiphertext<Element>& ciphertext, const EvalKey<Element> evalKey) const {
         VerifyLeveledSHEEnabled(__func__);
+        PerfScope perfScope(PerfOp::EVAL_MULT);
         return m_LeveledSHE->EvalSquare(ciphertext, evalKey);
     }
 
     virtual void EvalSquareInPlace(Ciphertext<Element>& ciphertext, const EvalKey<Element> evalKey) const {
         VerifyLeveledSHEEnabled(__func__);
+        PerfScope perfScope(PerfOp::EVAL_MULT);
         m_LeveledSHE->EvalSquareInPlace(ciphertext, evalKey);
     }
 
     virtual Ciphertext<Element> EvalSquareMutable(Ciphertext<Element>& ciphertext,
                                                   const EvalKey<Element> evalKey) const {
         VerifyLeveledSHEEnabled(__func__);
+        PerfScope perfScope(PerfOp::EVAL_MULT);
         return m_LeveledSHE->EvalSquareMutable(ciphertext, evalKey);
     }
 
@@ -558,6 +570,7 @@ public:
                                                        ConstCiphertext<Element>& ciphertext2,
                                                        const std::vector<EvalKey<Element>>& evalKeyVec) const {
         VerifyLeveledSHEEnabled(__func__);
+        PerfScope perfScope(PerfOp::EVAL_MULT);
         return m_LeveledSHE->EvalMultAndRelinearize(ciphertext1, ciphertext2, evalKeyVec);
     }
 
@@ -664,6 +677,7 @@ public:
         VerifyLeveledSHEEnabled(__func__);
         if (!ciphertext)
             OPENFHE_THROW("Input ciphertext is nullptr");
+        PerfScope perfScope(PerfOp::EVAL_ROTATE);
         return m_LeveledSHE->EvalFastRotation(ciphertext, index, m, digits);
     }
 
@@ -692,6 +706,7 @@ public:
         VerifyLeveledSHEEnabled(__func__);
         if (!ciphertext)
             OPENFHE_THROW("Input ciphertext is nullptr");
+        PerfScope perfScope(PerfOp::EVAL_ROTATE);
         return m_LeveledSHE->EvalFastRotationExt(ciphertext, index, digits, addFirst, evalKeys);
     }
 
@@ -720,6 +735,7 @@ public:
         VerifyLeveledSHEEnabled(__func__);
         if (!evalKeyMap.size())
             OPENFHE_THROW("Input evaluation key map is empty");
+        PerfScope perfScope(PerfOp::EVAL_ROTATE);
         return m_LeveledSHE->EvalAtIndex(ciphertext, i, evalKeyMap);
     }
 
@@ -834,6 +850,14 @@ public:
         return m_AdvancedSHE->EvalMultMany(ciphertextVec, evalKeyVec);
     }
 
+    virtual Ciphertext<Element> EvalReduceMany(
+        const std::vector<Ciphertext<Element>>& ciphertextVec,
+        const std::function<Ciphertext<Element>(ConstCiphertext<Element>&, ConstCiphertext<Element>&)>& op,
+        bool parallel) const {
+        VerifyAdvancedSHEEnabled(__func__);
+        return m_AdvancedSHE->EvalReduceMany(ciphertextVec, op, parallel);
+    }
+
     /////////////////////////////////////
     // Advanced SHE LINEAR WEIGHTED SUM
     /////////////////////////////////////
@@ -1078,6 +1102,19 @@ public:
     virtual EvalKey<Element> MultiAddEvalMultKeys(EvalKey<Element> evalKey1, EvalKey<Element> evalKey2,
                                                   const std::string& keyId);
 
+    virtual PublicKey<Element> MultiAddPubKeys(const std::vector<PublicKey<Element>>& publicKeyVec,
+                                               const std::string& keyId);
+
+    virtual EvalKey<Element> MultiAddEvalKeys(const std::vector<EvalKey<Element>>& evalKeyVec,
+                                              const std::string& keyId);
+
+    virtual EvalKey<Element> MultiAddEvalMultKeys(const std::vector<EvalKey<Element>>& evalKeyVec,
+                                                  const std::string& keyId);
+
+    virtual std::shared_ptr<std::map<uint32_t, EvalKey<Element>>> MultiAddEvalAutomorphismKeys(
+        const std::vector<std::shared_ptr<std::map<uint32_t, EvalKey<Element>>>>& evalKeyMapVec,
+        const std::string& keyId);
+
     Ciphertext<Element> IntBootAdjustScale(ConstCiphertext<Element>& ciphertext) const {
         VerifyMultipartyEnabled(__func__);
         return m_Multiparty->IntBootAdjustScale(ciphertext);
@@ -1142,9 +1179,11 @@ public:
 
     void EvalBootstrapSetup(const CryptoContextImpl<Element>& cc, const std::vector<uint32_t>& levelBudget = {5, 4},
                             const std::vector<uint32_t>& dim1 = {0, 0}, uint32_t slots = 0,
-                            uint32_t correctionFactor = 0, bool precompute = true, bool BTSlotsEncoding = false) {
+                            uint32_t correctionFactor = 0, bool precompute = true, bool BTSlotsEncoding = false,
+                            bool compactPrecompute = false) {
         VerifyFHEEnabled(__func__);
-        m_FHE->EvalBootstrapSetup(cc, levelBudget, dim1, slots, correctionFactor, precompute, BTSlotsEncoding);
+        m_FHE->EvalBootstrapSetup(cc, levelBudget, dim1, slots, correctionFactor, precompute, BTSlotsEncoding,
+                                  compactPrecompute);
     }
 
     std::shared_ptr<std::map<uint32_t, EvalKey<Element>>> EvalBootstrapKeyGen(const PrivateKey<Element> privateKey,
@@ -1153,9 +1192,46 @@ public:
         return m_FHE->EvalBootstrapKeyGen(privateKey, slots);
     }
 
-    void EvalBootstrapPrecompute(const CryptoContextImpl<Element>& cc, uint32_t slots = 0) {
+    std::shared_ptr<std::map<uint32_t, EvalKey<Element>>> EvalBootstrapKeyGen(const PrivateKey<Element> privateKey,
+                                                                              const std::vector<uint32_t>& slots) {
+        VerifyFHEEnabled(__func__);
+        return m_FHE->EvalBootstrapKeyGen(privateKey, slots);
+    }
+
+    std::vector<CKKSBootstrapConfig> PlanBootstrapKeySet(const CryptoContextImpl<Element>& cc,
+                                                         const std::vector<CKKSBootstrapConfig>& configs) const {
+        VerifyFHEEnabled(__func__);
+        return m_FHE->PlanBootstrapKeySet(cc, configs);
+    }
+
+    std::vector<int32_t> GetBootstrapRotationIndices(const CryptoContextImpl<Element>& cc,
+                                                     const std::vector<CKKSBootstrapConfig>& configs) const {
+        VerifyFHEEnabled(__func__);
+        return m_FHE->GetBootstrapRotationIndices(cc, configs);
+    }
+
+    void EvalBootstrapPrecompute(const CryptoContextImpl<Element>& cc, uint32_t slots = 0,
+                                 bool compactPrecompute = false) {
         VerifyFHEEnabled(__func__);
-        m_FHE->EvalBootstrapPrecompute(cc, slots);
+        m_FHE->EvalBootstrapPrecompute(cc, slots, compactPrecompute);
+    }
+
+    std::string GetBootstrapPrecomputeFingerprint(const CryptoContextImpl<Element>& cc,
+                                                  std::vector<uint32_t> levelBudget, std::vector<uint32_t> dim1,
+                                                  uint32_t slots, bool BTSlotsEncoding) const {
+        VerifyFHEEnabled(__func__);
+        return m_FHE->GetBootstrapPrecomputeFingerprint(cc, levelBudget, dim1, slots, BTSlotsEncoding);
+    }
+
+    std::shared_ptr<CKKSBootstrapPrecomData> ExportBootstrapPrecompute(const CryptoContextImpl<Element>& cc,
+                                                                       uint32_t slots) const {
+        VerifyFHEEnabled(__func__);
+        return m_FHE->ExportBootstrapPrecompute(cc, slots);
+    }
+
+    void ImportBootstrapPrecompute(const CryptoContextImpl<Element>& cc, const CKKSBootstrapPrecomData& data) {
+        VerifyFHEEnabled(__func__);
+        m_FHE->ImportBootstrapPrecompute(cc, data);
     }
 
     Ciphertext<Element> EvalBootstrap(ConstCiphertext<Element>& ciphertext, uint32_t numIterations = 1,
@@ -1164,6 +1240,12 @@ public:
         return m_FHE->EvalBootstrap(ciphertext, numIterations, precision);
     }
 
+    std::vector<Ciphertext<Element>> EvalBootstrapBatch(const std::vector<Ciphertext<Element>>& ciphertexts,
+                                                        uint32_t numIterations = 1, uint32_t precision = 0) const {
+        VerifyFHEEnabled(__func__);
+        return m_FHE->EvalBootstrapBatch(ciphertexts, numIterations, precision);
+    }
+
     Ciphertext<Element> EvalBootstrapStCFirst(ConstCiphertext<Element>& ciphertext, uint32_t numIterations = 1,
                                               uint32_t precision = 0) const {
         VerifyFHEEnabled(__func__);
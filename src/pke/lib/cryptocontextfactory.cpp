@@ -33,49 +33,172 @@
 #include "schemebase/base-scheme.h"
 #include "scheme/scheme-id.h"
 
+#include <algorithm>
+
 namespace lbcrypto {
 
 template <>
 std::vector<CryptoContext<DCRTPoly>> CryptoContextFactory<DCRTPoly>::AllContexts = {};
+template <>
+std::unordered_multimap<size_t, CryptoContext<DCRTPoly>> CryptoContextFactory<DCRTPoly>::ContextsByFingerprint = {};
+template <>
+std::unordered_map<const CryptoContextImpl<DCRTPoly>*, CryptoContext<DCRTPoly>>
+    CryptoContextFactory<DCRTPoly>::ContextsByPointer = {};
+template <>
+std::shared_mutex CryptoContextFactory<DCRTPoly>::ContextsMutex{};
+
+static size_t HashCombine(size_t lhs, size_t rhs) {
+    return lhs ^ (rhs + 0x9e3779b9 + (lhs << 6) + (lhs >> 2));
+}
 
 template <typename Element>
-CryptoContext<Element> CryptoContextFactory<Element>::FindContext(std::shared_ptr<CryptoParametersBase<Element>> params,
-                                                                  std::shared_ptr<SchemeBase<Element>> scheme) {
-    for (CryptoContext<Element> cc : CryptoContextFactory<Element>::AllContexts) {
-        if (*cc->GetScheme().get() == *scheme.get() && *cc->GetCryptoParameters().get() == *params.get()) {
-            if (cc->GetEncodingParams()->GetPlaintextRootOfUnity() != 0) {
-                PackedEncoding::SetParams(cc->GetCyclotomicOrder(), cc->GetEncodingParams());
-            }
-            return cc;
-        }
+static void SetPackedEncodingParams(const CryptoContext<Element>& cc) {
+    if (cc->GetEncodingParams()->GetPlaintextRootOfUnity() != 0) {
+        PackedEncoding::SetParams(cc->GetCyclotomicOrder(), cc->GetEncodingParams());
     }
+}
 
+template <typename Element>
+size_t CryptoContextFactory<Element>::GetFingerprint(const CryptoParametersBase<Element>& params) {
+    // Only fields compared by CryptoParametersBase::CompareTo() are hashed, so that equal parameters always
+    // have equal fingerprints. The full comparison is done on the (few) contexts sharing a fingerprint
+    size_t seed = 0;
+    if (const auto& elementParams = params.GetElementParams()) {
+        seed = HashCombine(seed, std::hash<uint32_t>{}(elementParams->GetCyclotomicOrder()));
+        seed = HashCombine(seed, std::hash<uint32_t>{}(elementParams->GetRingDimension()));
+        seed = HashCombine(seed, std::hash<double>{}(elementParams->GetModulus().ConvertToDouble()));
+    }
+    if (const auto& encodingParams = params.GetEncodingParams()) {
+        seed = HashCombine(seed, std::hash<PlaintextModulus>{}(encodingParams->GetPlaintextModulus()));
+        seed = HashCombine(seed, std::hash<uint32_t>{}(encodingParams->GetBatchSize()));
+    }
+    return seed;
+}
+
+template <typename Element>
+CryptoContext<Element> CryptoContextFactory<Element>::FindContextLocked(
+    size_t fingerprint, const std::shared_ptr<CryptoParametersBase<Element>>& params,
+    const std::shared_ptr<SchemeBase<Element>>& scheme) {
+    auto range = ContextsByFingerprint.equal_range(fingerprint);
+    for (auto it = range.first; it != range.second; ++it) {
+        const auto& cc = it->second;
+        if (*cc->GetScheme().get() == *scheme.get() && *cc->GetCryptoParameters().get() == *params.get())
+            return cc;
+    }
     return nullptr;
 }
 
 template <typename Element>
-void CryptoContextFactory<Element>::AddContext(CryptoContext<Element> cc) {
-    CryptoContextFactory<Element>::AllContexts.push_back(cc);
+void CryptoContextFactory<Element>::AddContextLocked(size_t fingerprint, const CryptoContext<Element>& cc) {
+    AllContexts.push_back(cc);
+    ContextsByFingerprint.emplace(fingerprint, cc);
+    ContextsByPointer.emplace(cc.get(), cc);
+}
 
-    if (cc->GetEncodingParams()->GetPlaintextRootOfUnity() != 0) {
-        PackedEncoding::SetParams(cc->GetCyclotomicOrder(), cc->GetEncodingParams());
+template <typename Element>
+CryptoContext<Element> CryptoContextFactory<Element>::FindContext(std::shared_ptr<CryptoParametersBase<Element>> params,
+                                                                  std::shared_ptr<SchemeBase<Element>> scheme) {
+    const size_t fingerprint = GetFingerprint(*params);
+    CryptoContext<Element> cc;
+    {
+        std::shared_lock<std::shared_mutex> lock(ContextsMutex);
+        cc = FindContextLocked(fingerprint, params, scheme);
     }
+    if (nullptr != cc)
+        SetPackedEncodingParams(cc);
+    return cc;
+}
+
+template <typename Element>
+void CryptoContextFactory<Element>::AddContext(CryptoContext<Element> cc) {
+    {
+        std::unique_lock<std::shared_mutex> lock(ContextsMutex);
+        AddContextLocked(GetFingerprint(*cc->GetCryptoParameters()), cc);
+    }
+    SetPackedEncodingParams(cc);
 }
 
 template <typename Element>
 CryptoContext<Element> CryptoContextFactory<Element>::GetContext(std::shared_ptr<CryptoParametersBase<Element>> params,
                                                                  std::shared_ptr<SchemeBase<Element>> scheme,
                                                                  SCHEME schemeId) {
-    CryptoContext<Element> cc = FindContext(params, scheme);
-    // if the context is not found we should create one
+    const size_t fingerprint = GetFingerprint(*params);
+    CryptoContext<Element> cc;
+    {
+        std::shared_lock<std::shared_mutex> lock(ContextsMutex);
+        cc = FindContextLocked(fingerprint, params, scheme);
+    }
+    // if the context is not found we should create one. Another thread may have added an equivalent context
+    // after the shared lock was released, so look again while holding the exclusive lock
     if (nullptr == cc) {
-        cc = std::make_shared<CryptoContextImpl<Element>>(params, scheme, schemeId);
-        AddContext(cc);
+        std::unique_lock<std::shared_mutex> lock(ContextsMutex);
+        cc = FindContextLocked(fingerprint, params, scheme);
+        if (nullptr == cc) {
+            cc = std::make_shared<CryptoContextImpl<Element>>(params, scheme, schemeId);
+            AddContextLocked(fingerprint, cc);
+        }
     }
+    SetPackedEncodingParams(cc);
 
     return cc;
 }
 
+template <typename Element>
+CryptoContext<Element> CryptoContextFactory<Element>::GetContextForPointer(const CryptoContextImpl<Element>* cc) {
+    std::shared_lock<std::shared_mutex> lock(ContextsMutex);
+    auto it = ContextsByPointer.find(cc);
+    return (it != ContextsByPointer.end()) ? it->second : nullptr;
+}
+
+template <typename Element>
+void CryptoContextFactory<Element>::ReleaseAllContexts() {
+    // the contexts are destroyed after the lock is released
+    std::vector<CryptoContext<Element>> released;
+    {
+        std::unique_lock<std::shared_mutex> lock(ContextsMutex);
+        released.swap(AllContexts);
+        ContextsByFingerprint.clear();
+        ContextsByPointer.clear();
+    }
+    if (released.size() > 0)
+        released[0]->ClearStaticMapsAndVectors();
+}
+
+template <typename Element>
+bool CryptoContextFactory<Element>::ReleaseContext(const CryptoContext<Element>& cc) {
+    if (nullptr == cc)
+        return false;
+    {
+        std::unique_lock<std::shared_mutex> lock(ContextsMutex);
+        if (ContextsByPointer.erase(cc.get()) == 0)
+            return false;
+
+        auto range = ContextsByFingerprint.equal_range(GetFingerprint(*cc->GetCryptoParameters()));
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == cc) {
+                ContextsByFingerprint.erase(it);
+                break;
+            }
+        }
+        AllContexts.erase(std::remove(AllContexts.begin(), AllContexts.end(), cc), AllContexts.end());
+    }
+    CryptoContextImpl<Element>::ClearEvalMultKeys(cc);
+    CryptoContextImpl<Element>::ClearEvalAutomorphismKeys(cc);
+    return true;
+}
+
+template <typename Element>
+int CryptoContextFactory<Element>::GetContextCount() {
+    std::shared_lock<std::shared_mutex> lock(ContextsMutex);
+    return AllContexts.size();
+}
+
+template <typename Element>
+std::vector<CryptoContext<Element>> CryptoContextFactory<Element>::GetAllContexts() {
+    std::shared_lock<std::shared_mutex> lock(ContextsMutex);
+    return AllContexts;
+}
+
 template <typename Element>
 CryptoContext<Element> CryptoContextFactory<Element>::GetFullContextByDeserializedContext(
     const CryptoContext<Element> context) {
@@ -43,6 +43,7 @@
 #include "key/publickey.h"
 #include "keyswitch/keyswitch-bv.h"
 #include "schemerns/rns-cryptoparameters.h"
+#include "utils/profiler.h"
 
 namespace lbcrypto {
 
@@ -257,6 +258,8 @@ std::shared_ptr<std::vector<DCRTPoly>> KeySwitchBV::EvalKeySwitchPrecomputeCore(
 std::shared_ptr<std::vector<DCRTPoly>> KeySwitchBV::EvalFastKeySwitchCore(
     const std::shared_ptr<std::vector<DCRTPoly>> digits, const EvalKey<DCRTPoly> evalKey,
     const std::shared_ptr<ParmType> paramsQl) const {
+    PerfScope perfScope(PerfOp::KEY_SWITCH);
+
     std::vector<DCRTPoly> bv(evalKey->GetBVector());
     std::vector<DCRTPoly> av(evalKey->GetAVector());
     const auto diffQl    = bv[0].GetParams()->GetParams().size() - paramsQl->GetParams().size();
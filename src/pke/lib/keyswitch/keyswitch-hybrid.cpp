@@ -40,6 +40,7 @@
 #include "key/publickey.h"
 #include "keyswitch/keyswitch-hybrid.h"
 #include "scheme/ckksrns/ckksrns-cryptoparameters.h"
+#include "utils/profiler.h"
 
 namespace lbcrypto {
 
@@ -402,6 +403,9 @@ std::shared_ptr<std::vector<DCRTPoly>> KeySwitchHYBRID::EvalFastKeySwitchCore(
 std::shared_ptr<std::vector<DCRTPoly>> KeySwitchHYBRID::EvalFastKeySwitchCoreExt(
     const std::shared_ptr<std::vector<DCRTPoly>> digits, const EvalKey<DCRTPoly> evalKey,
     const std::shared_ptr<ParmType> paramsQl) const {
+    // every hybrid key switch, hoisted or not, goes through the key inner product below
+    PerfScope perfScope(PerfOp::KEY_SWITCH);
+
     const auto paramsQlP   = (*digits)[0].GetParams();
     const uint32_t sizeQlP = paramsQlP->GetParams().size();
 
@@ -415,20 +419,28 @@ std::shared_ptr<std::vector<DCRTPoly>> KeySwitchHYBRID::EvalFastKeySwitchCoreExt
 
     auto result = std::make_shared<std::vector<DCRTPoly>>();
     result->reserve(2);
-    result->emplace_back(paramsQlP, Format::EVALUATION, true);
-    result->emplace_back(paramsQlP, Format::EVALUATION, true);
+    result->emplace_back(paramsQlP, Format::EVALUATION);
+    result->emplace_back(paramsQlP, Format::EVALUATION);
     auto& elements = (*result);
 
-    for (uint32_t j = 0; j < limit; ++j) {
+    const uint32_t ringDim = paramsQlP->GetRingDimension();
+
+    // The inner product is accumulated per tower with Montgomery products, which carry a common
+    // factor R^{-1}; a single ToMontgomeryEq() per tower removes it, so every term costs one REDC
+    // instead of a Barrett reduction and no temporary polynomials are allocated.
 #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(sizeQlP))
-        for (uint32_t i = 0; i < sizeQlP; ++i) {
-            const auto idx  = (i >= sizeQl) ? i + delta : i;
-            const auto& cji = (*digits)[j].GetElementAtIndex(i);
-            const auto& bji = bv[j].GetElementAtIndex(idx);
-            const auto& aji = av[j].GetElementAtIndex(idx);
-            elements[0].SetElementAtIndex(i, elements[0].GetElementAtIndex(i) + cji * bji);
-            elements[1].SetElementAtIndex(i, elements[1].GetElementAtIndex(i) + cji * aji);
+    for (uint32_t i = 0; i < sizeQlP; ++i) {
+        const auto idx      = (i >= sizeQl) ? i + delta : i;
+        const auto& modulus = paramsQlP->GetParams()[i]->GetModulus();
+        NativeVector sum0(ringDim, modulus);
+        NativeVector sum1(ringDim, modulus);
+        for (uint32_t j = 0; j < limit; ++j) {
+            const auto& cji = (*digits)[j].GetElementAtIndex(i).GetValues();
+            sum0.ModMulAddMontgomeryEq(cji, bv[j].GetElementAtIndex(idx).GetValues());
+            sum1.ModMulAddMontgomeryEq(cji, av[j].GetElementAtIndex(idx).GetValues());
         }
+        elements[0].GetAllElements()[i].SetValues(std::move(sum0.ToMontgomeryEq()), Format::EVALUATION);
+        elements[1].GetAllElements()[i].SetValues(std::move(sum1.ToMontgomeryEq()), Format::EVALUATION);
     }
 
     return result;
@@ -125,18 +125,18 @@ void CryptoParametersBFVRNS::PrecomputeCRTTables(KeySwitchTechnique ksTech, Scal
     if (multTech != BEHZ) {
         uint32_t sizeR = (multTech == HPS) ? sizeQ + 1 : sizeQ;
         std::vector<NativeInteger> moduliR(sizeR);
-        std::vector<NativeInteger> rootsR(sizeR);
+        std::vector<NativeInteger> rootsR;
         m_modrBarrettMu.resize(sizeR);
 
         moduliR[0]         = modulusr;
-        rootsR[0]          = rootr;
         m_modrBarrettMu[0] = (BarrettBase128Bit / BigInteger(moduliR[0])).ConvertToInt<DoubleNativeInt>();
 
         for (uint32_t j = 1; j < sizeR; ++j) {
             moduliR[j]         = PreviousPrime<NativeInteger>(moduliR[j - 1], 2 * n);
-            rootsR[j]          = RootOfUnity<NativeInteger>(2 * n, moduliR[j]);
             m_modrBarrettMu[j] = (BarrettBase128Bit / BigInteger(moduliR[j])).ConvertToInt<DoubleNativeInt>();
         }
+        // rootsR[0] is already cached, the remaining roots are searched for concurrently
+        rootsR = RootsOfUnity<NativeInteger>(2 * n, moduliR);
 
         ChineseRemainderTransformFTT<NativeVector>().PreCompute(rootsR, 2 * n, moduliR);
 
@@ -141,13 +141,7 @@ DecryptResult MultipartyBFVRNS::MultipartyDecryptFusion(const std::vector<Cipher
     const auto cryptoParams =
         std::dynamic_pointer_cast<CryptoParametersBFVRNS>(ciphertextVec[0]->GetCryptoParameters());
 
-    const std::vector<DCRTPoly>& cv0 = ciphertextVec[0]->GetElements();
-
-    DCRTPoly b = cv0[0];
-    for (size_t i = 1; i < ciphertextVec.size(); i++) {
-        const std::vector<DCRTPoly>& cvi = ciphertextVec[i]->GetElements();
-        b += cvi[0];
-    }
+    DCRTPoly b = SumPartialDecryptions(ciphertextVec);
 
     size_t sizeQl = b.GetNumOfElements();
 
@@ -38,10 +38,13 @@ BGV implementation. See https://eprint.iacr.org/2021/204 for details.
 #include "ciphertext.h"
 #include "scheme/bgvrns/bgvrns-cryptoparameters.h"
 #include "scheme/bgvrns/bgvrns-leveledshe.h"
+#include "utils/profiler.h"
 
 namespace lbcrypto {
 
 void LeveledSHEBGVRNS::ModReduceInternalInPlace(Ciphertext<DCRTPoly>& ciphertext, size_t levels) const {
+    PerfScope perfScope(PerfOp::MOD_REDUCE, levels);
+
     const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersBGVRNS>(ciphertext->GetCryptoParameters());
 
     const auto t = ciphertext->GetCryptoParameters()->GetPlaintextModulus();
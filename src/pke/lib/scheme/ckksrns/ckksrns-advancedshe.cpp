@@ -39,6 +39,7 @@ CKKS implementation. See https://eprint.iacr.org/2020/1118 for details.
 #include "scheme/ckksrns/ckksrns-utils.h"
 #include "schemebase/base-scheme.h"
 
+#include <algorithm>
 #include <complex>
 #include <vector>
 
@@ -54,31 +55,18 @@ Ciphertext<DCRTPoly> AdvancedSHECKKSRNS::EvalMultMany(const std::vector<Cipherte
     if (inSize == 1)
         return ciphertextVec[0]->Clone();
 
-    const uint32_t lim = inSize * 2 - 2;
-    std::vector<Ciphertext<DCRTPoly>> ciphertextMultVec(inSize - 1);
-
     auto algo               = ciphertextVec[0]->GetCryptoContext()->GetScheme();
     const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersRNS>(ciphertextVec[0]->GetCryptoParameters());
     uint32_t levelsToDrop   = cryptoParams->GetCompositeDegree();
 
-    uint32_t i = 0, j = 0;
-    for (; i < (inSize - 1); i += 2) {
-        ciphertextMultVec[j] = algo->EvalMultAndRelinearize(ciphertextVec[i], ciphertextVec[i + 1], evalKeys);
-        algo->ModReduceInPlace(ciphertextMultVec[j++], levelsToDrop);
-    }
-    if (i < inSize) {
-        ciphertextMultVec[j] =
-            algo->EvalMultAndRelinearize(ciphertextVec[i], ciphertextMultVec[i + 1 - inSize], evalKeys);
-        algo->ModReduceInPlace(ciphertextMultVec[j++], levelsToDrop);
-        i += 2;
-    }
-    for (; i < lim; i += 2) {
-        ciphertextMultVec[j] =
-            algo->EvalMultAndRelinearize(ciphertextMultVec[i - inSize], ciphertextMultVec[i + 1 - inSize], evalKeys);
-        algo->ModReduceInPlace(ciphertextMultVec[j++], levelsToDrop);
-    }
-
-    return ciphertextMultVec.back();
+    // ModReduceInPlace is a no-op for the automated scaling techniques: the rescaling is then
+    // deferred to the next multiplication and the level-aware ordering accounts for it
+    return EvalReduceMany(ciphertextVec, [&algo, &evalKeys, levelsToDrop](ConstCiphertext<DCRTPoly>& ct1,
+                                                                          ConstCiphertext<DCRTPoly>& ct2) {
+        auto result = algo->EvalMultAndRelinearize(ct1, ct2, evalKeys);
+        algo->ModReduceInPlace(result, levelsToDrop);
+        return result;
+    });
 }
 
 //------------------------------------------------------------------------------
@@ -568,6 +556,33 @@ Ciphertext<DCRTPoly> AdvancedSHECKKSRNS::EvalPolyPS(ConstCiphertext<DCRTPoly>& x
 // EVAL CHEBYSHEV SERIES
 //------------------------------------------------------------------------------
 
+// Computes T_2(y), ... , T_k(y) from T_1(y) = T[0] by binary tree multiplication.
+// T_i(y) only depends on T_{floor(i/2)}(y) and T_{ceil(i/2)}(y), so the polynomials of degrees 2^j+1, ... , 2^{j+1}
+// are independent of each other once the lower degrees are available and are computed concurrently.
+static void EvalChebyPolysBinaryTree(std::vector<Ciphertext<DCRTPoly>>& T) {
+    const uint32_t k = T.size();
+    auto cc          = T[0]->GetCryptoContext();
+    for (uint32_t lo = 2, hi = 2; lo <= k; lo = hi + 1, hi = std::min(2 * hi, k)) {
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(hi - lo + 1))
+        for (uint32_t i = lo; i <= hi; ++i) {
+            if (i & 0x1) {  // if i is odd
+                // compute T_{2i+1}(y) = 2*T_i(y)*T_{i+1}(y) - y
+                T[i - 1] = cc->EvalMult(T[i / 2 - 1], T[i / 2]);
+                cc->EvalAddInPlaceNoCheck(T[i - 1], T[i - 1]);
+                cc->ModReduceInPlace(T[i - 1]);
+                cc->EvalSubInPlace(T[i - 1], T[0]);
+            }
+            else {
+                // compute T_{2i}(y) = 2*T_i(y)^2 - 1
+                T[i - 1] = cc->EvalSquare(T[i / 2 - 1]);
+                cc->EvalAddInPlaceNoCheck(T[i - 1], T[i - 1]);
+                cc->ModReduceInPlace(T[i - 1]);
+                cc->EvalAddInPlace(T[i - 1], -1.0);
+            }
+        }
+    }
+}
+
 template <typename VectorDataType>
 std::shared_ptr<seriesPowers<DCRTPoly>> internalEvalChebyPolysLinear(ConstCiphertext<DCRTPoly>& x,
                                                                      const std::vector<VectorDataType>& coefficients,
@@ -594,23 +609,7 @@ std::shared_ptr<seriesPowers<DCRTPoly>> internalEvalChebyPolysLinear(ConstCipher
 
     // Computes Chebyshev polynomials up to degree k
     // for y: T_1(y) = y, T_2(y), ... , T_k(y)
-    // uses binary tree multiplication
-    for (uint32_t i = 2; i <= k; ++i) {
-        if (i & 0x1) {  // if i is odd
-            // compute T_{2i+1}(y) = 2*T_i(y)*T_{i+1}(y) - y
-            T[i - 1] = cc->EvalMult(T[i / 2 - 1], T[i / 2]);
-            cc->EvalAddInPlaceNoCheck(T[i - 1], T[i - 1]);
-            cc->ModReduceInPlace(T[i - 1]);
-            cc->EvalSubInPlace(T[i - 1], T[0]);
-        }
-        else {
-            // compute T_{2i}(y) = 2*T_i(y)^2 - 1
-            T[i - 1] = cc->EvalSquare(T[i / 2 - 1]);
-            cc->EvalAddInPlaceNoCheck(T[i - 1], T[i - 1]);
-            cc->ModReduceInPlace(T[i - 1]);
-            cc->EvalAddInPlace(T[i - 1], -1.0);
-        }
-    }
+    EvalChebyPolysBinaryTree(T);
 
     uint32_t compositeDegree =
         std::dynamic_pointer_cast<CryptoParametersCKKSRNS>(x->GetCryptoParameters())->GetCompositeDegree();
@@ -674,6 +673,7 @@ Ciphertext<DCRTPoly> InnerEvalChebyshevPS(ConstCiphertext<DCRTPoly>& x, const st
 
     Ciphertext<DCRTPoly> cu, qu, su;
 
+#pragma omp task shared(qu)
     {
         // Evaluate q and s2 at u.
         // If their degrees are larger than k, then recursively apply the Paterson-Stockmeyer algorithm.
@@ -702,6 +702,7 @@ Ciphertext<DCRTPoly> InnerEvalChebyshevPS(ConstCiphertext<DCRTPoly>& x, const st
         }
     }
 
+#pragma omp task shared(su)
     {
         // Add x^{k(2^{m-1} - 1)} to s
         auto& s2 = divcs->r;
@@ -754,6 +755,8 @@ Ciphertext<DCRTPoly> InnerEvalChebyshevPS(ConstCiphertext<DCRTPoly>& x, const st
 
     cu = cu ? cc->EvalAdd(T2[m - 1], cu) : cc->EvalAdd(T2[m - 1], divcs->q.front() / 2.0);
 
+#pragma omp taskwait
+
     auto result = cc->EvalMult(cu, qu);
     cc->ModReduceInPlace(result);
     cc->EvalAddInPlace(result, su);
@@ -787,31 +790,17 @@ std::shared_ptr<seriesPowers<DCRTPoly>> internalEvalChebyPolysPS(ConstCiphertext
 
     // Computes Chebyshev polynomials up to degree k
     // for y: T_1(y) = y, T_2(y), ... , T_k(y)
-    // uses binary tree multiplication
-    for (uint32_t i = 2; i <= k; ++i) {
-        if (i & 0x1) {  // if i is odd
-            // compute T_{2i+1}(y) = 2*T_i(y)*T_{i+1}(y) - y
-            T[i - 1] = cc->EvalMult(T[i / 2 - 1], T[i / 2]);
-            cc->EvalAddInPlaceNoCheck(T[i - 1], T[i - 1]);
-            cc->ModReduceInPlace(T[i - 1]);
-            cc->EvalSubInPlace(T[i - 1], T[0]);
-        }
-        else {
-            // compute T_{2i}(y) = 2*T_i(y)^2 - 1
-            T[i - 1] = cc->EvalSquare(T[i / 2 - 1]);
-            cc->EvalAddInPlaceNoCheck(T[i - 1], T[i - 1]);
-            cc->ModReduceInPlace(T[i - 1]);
-            cc->EvalAddInPlace(T[i - 1], -1.0);
-        }
-    }
+    EvalChebyPolysBinaryTree(T);
 
     const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSRNS>(T[k - 1]->GetCryptoParameters());
     if (cryptoParams->GetScalingTechnique() == FIXEDMANUAL) {
         // brings all powers of x to the same level
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(k - 1))
         for (uint32_t i = 1; i < k; ++i)
             cc->LevelReduceInPlace(T[i - 1], nullptr, T[k - 1]->GetLevel() - T[i - 1]->GetLevel());
     }
     else {
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(k - 1))
         for (uint32_t i = 1; i < k; ++i)
             cc->GetScheme()->AdjustLevelsAndDepthInPlace(T[i - 1], T[k - 1]);
     }
@@ -823,18 +812,27 @@ std::shared_ptr<seriesPowers<DCRTPoly>> internalEvalChebyPolysPS(ConstCiphertext
     // computes T_{k(2*m - 1)}(y)
     auto T2km1 = T.back();
 
-    for (uint32_t i = 1; i < m; ++i) {
-        // Compute the Chebyshev polynomials T_k(y), T_{2k}(y), T_{4k}(y), ... , T_{2^{m-1}k}(y)
-        T2[i] = cc->EvalSquare(T2[i - 1]);
-        cc->EvalAddInPlaceNoCheck(T2[i], T2[i]);
-        cc->ModReduceInPlace(T2[i]);
-        cc->EvalAddInPlace(T2[i], -1.0);
+    // the update of T_{k(2*m - 1)}(y) with T2[i] runs while T2[i + 1] is computed
+#pragma omp parallel num_threads(OpenFHEParallelControls.GetThreadLimit(2))
+    {
+#pragma omp single
+        for (uint32_t i = 1; i < m; ++i) {
+            // Compute the Chebyshev polynomials T_k(y), T_{2k}(y), T_{4k}(y), ... , T_{2^{m-1}k}(y)
+            T2[i] = cc->EvalSquare(T2[i - 1]);
+            cc->EvalAddInPlaceNoCheck(T2[i], T2[i]);
+            cc->ModReduceInPlace(T2[i]);
+            cc->EvalAddInPlace(T2[i], -1.0);
 
-        // compute T_{k(2*m - 1)} = 2*T_{k(2^{m-1}-1)}(y)*T_{k*2^{m-1}}(y) - T_k(y)
-        T2km1 = cc->EvalMult(T2km1, T2[i]);
-        cc->EvalAddInPlaceNoCheck(T2km1, T2km1);
-        cc->ModReduceInPlace(T2km1);
-        cc->EvalSubInPlace(T2km1, T2[0]);
+#pragma omp taskwait
+#pragma omp task shared(T2km1, T2)
+            {
+                // compute T_{k(2*m - 1)} = 2*T_{k(2^{m-1}-1)}(y)*T_{k*2^{m-1}}(y) - T_k(y)
+                T2km1 = cc->EvalMult(T2km1, T2[i]);
+                cc->EvalAddInPlaceNoCheck(T2km1, T2km1);
+                cc->ModReduceInPlace(T2km1);
+                cc->EvalSubInPlace(T2km1, T2[0]);
+            }
+        }
     }
 
     return std::make_shared<seriesPowers<DCRTPoly>>(std::move(T), std::move(T2), std::move(T2km1), k, m);
@@ -858,7 +856,15 @@ Ciphertext<DCRTPoly> internalEvalChebyshevSeriesPSWithPrecomp(const std::shared_
     f2.resize(2 * k2m2k + k + 1);
     f2.back() = 1;
 
-    return T[0]->GetCryptoContext()->EvalSub(InnerEvalChebyshevPS(T[0], f2, k, m, T, T2), T2km1);
+    // the sub-polynomials of the Paterson-Stockmeyer recursion are evaluated as concurrent tasks; the thread limit
+    // bounds the number of them, and of their temporary ciphertexts, that are alive at the same time
+    Ciphertext<DCRTPoly> result;
+#pragma omp parallel num_threads(OpenFHEParallelControls.GetThreadLimit(6 * m + 2))
+    {
+#pragma omp single
+        result = T[0]->GetCryptoContext()->EvalSub(InnerEvalChebyshevPS(T[0], f2, k, m, T, T2), T2km1);
+    }
+    return result;
 }
 
 std::shared_ptr<seriesPowers<DCRTPoly>> AdvancedSHECKKSRNS::EvalChebyPolys(ConstCiphertext<DCRTPoly>& x,
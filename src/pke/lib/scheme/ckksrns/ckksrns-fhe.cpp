@@ -41,7 +41,9 @@
 #include "scheme/ckksrns/ckksrns-utils.h"
 #include "schemebase/base-scheme.h"
 #include "utils/exception.h"
+#include "utils/hashutil.h"
 #include "utils/parallel.h"
+#include "utils/profiler.h"
 #include "utils/utilities.h"
 
 #include <algorithm>
@@ -50,10 +52,12 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <numeric>
 #ifdef BOOTSTRAPTIMING
     #include <ostream>
 #endif
 #include <set>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -74,6 +78,32 @@ double GetBigModulus(const std::shared_ptr<lbcrypto::CryptoParametersCKKSRNS> cr
     return qDouble;
 }
 
+lbcrypto::CKKSBootstrapPrecomData::PlaintextData ExportPlaintext(const lbcrypto::ReadOnlyPlaintext& pt) {
+    lbcrypto::CKKSBootstrapPrecomData::PlaintextData data;
+    if (pt) {
+        data.element       = pt->GetElement<lbcrypto::DCRTPoly>();
+        data.scalingFactor = pt->GetScalingFactor();
+        data.level         = pt->GetLevel();
+        data.noiseScaleDeg = pt->GetNoiseScaleDeg();
+        data.slots         = pt->GetSlots();
+        data.isSet         = true;
+    }
+    return data;
+}
+
+lbcrypto::ReadOnlyPlaintext ImportPlaintext(const lbcrypto::CryptoContextImpl<lbcrypto::DCRTPoly>& cc,
+                                            const lbcrypto::CKKSBootstrapPrecomData::PlaintextData& data) {
+    if (!data.isSet)
+        return nullptr;
+    // the encoded values are not kept: the plaintexts are only used through their DCRT elements
+    lbcrypto::Plaintext p = lbcrypto::Plaintext(std::make_shared<lbcrypto::CKKSPackedEncoding>(
+        data.element.GetParams(), cc.GetEncodingParams(), std::vector<std::complex<double>>(), data.noiseScaleDeg,
+        data.level, data.scalingFactor, data.slots, lbcrypto::COMPLEX));
+    p->GetElement<lbcrypto::DCRTPoly>() = data.element;
+    p->SetScalingFactor(data.scalingFactor);
+    return p;
+}
+
 }  // namespace
 
 namespace lbcrypto {
@@ -84,7 +114,7 @@ namespace lbcrypto {
 
 void FHECKKSRNS::EvalBootstrapSetup(const CryptoContextImpl<DCRTPoly>& cc, std::vector<uint32_t> levelBudget,
                                     std::vector<uint32_t> dim1, uint32_t numSlots, uint32_t correctionFactor,
-                                    bool precompute, bool BTSlotsEncoding) {
+                                    bool precompute, bool BTSlotsEncoding, bool compactPrecompute) {
     const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSRNS>(cc.GetCryptoParameters());
 
     if (cryptoParams->GetKeySwitchTechnique() != HYBRID)
@@ -119,10 +149,11 @@ void FHECKKSRNS::EvalBootstrapSetup(const CryptoContextImpl<DCRTPoly>& cc, std::
         m_correctionFactor = correctionFactor;
     }
 
-    m_bootPrecomMap[slots]  = std::make_shared<CKKSBootstrapPrecom>();
-    auto& precom            = m_bootPrecomMap[slots];
-    precom->m_slots         = slots;
-    precom->BTSlotsEncoding = BTSlotsEncoding;
+    m_bootPrecomMap[slots]      = std::make_shared<CKKSBootstrapPrecom>();
+    auto& precom                = m_bootPrecomMap[slots];
+    precom->m_slots             = slots;
+    precom->BTSlotsEncoding     = BTSlotsEncoding;
+    precom->m_compactPrecompute = compactPrecompute;
 
     // even for the case of a single slot we need one level for rescaling
     uint32_t logSlots = (slots < 3) ? 1 : std::log2(slots);
@@ -263,6 +294,14 @@ void FHECKKSRNS::EvalBootstrapSetup(const CryptoContextImpl<DCRTPoly>& cc, std::
 
 std::shared_ptr<std::map<uint32_t, EvalKey<DCRTPoly>>> FHECKKSRNS::EvalBootstrapKeyGen(
     const PrivateKey<DCRTPoly> privateKey, uint32_t slots) {
+    return EvalBootstrapKeyGen(privateKey, std::vector<uint32_t>{slots});
+}
+
+std::shared_ptr<std::map<uint32_t, EvalKey<DCRTPoly>>> FHECKKSRNS::EvalBootstrapKeyGen(
+    const PrivateKey<DCRTPoly> privateKey, const std::vector<uint32_t>& slots) {
+    if (slots.empty())
+        OPENFHE_THROW("No numbers of slots to generate bootstrapping keys for.");
+
     const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSRNS>(privateKey->GetCryptoParameters());
 
     if (cryptoParams->GetKeySwitchTechnique() != HYBRID)
@@ -276,10 +315,14 @@ std::shared_ptr<std::map<uint32_t, EvalKey<DCRTPoly>>> FHECKKSRNS::EvalBootstrap
     auto algo = cc->GetScheme();
     auto M    = cc->GetCyclotomicOrder();
 
-    slots = (slots == 0) ? M / 4 : slots;
-
-    // computing all indices for baby-step giant-step procedure
-    auto evalKeys = algo->EvalAtIndexKeyGen(privateKey, FindBootstrapRotationIndices(slots, M));
+    // computing all indices for baby-step giant-step procedure; the ones shared by several numbers of slots are
+    // generated once
+    std::set<int32_t> indices;
+    for (uint32_t s : slots) {
+        auto tmp = FindBootstrapRotationIndices((s == 0) ? M / 4 : s, M);
+        indices.insert(tmp.begin(), tmp.end());
+    }
+    auto evalKeys = algo->EvalAtIndexKeyGen(privateKey, std::vector<int32_t>(indices.begin(), indices.end()));
 
     (*evalKeys)[M - 1] = ConjugateKeyGen(privateKey);
 
@@ -299,7 +342,84 @@ std::shared_ptr<std::map<uint32_t, EvalKey<DCRTPoly>>> FHECKKSRNS::EvalBootstrap
     return evalKeys;
 }
 
-void FHECKKSRNS::EvalBootstrapPrecompute(const CryptoContextImpl<DCRTPoly>& cc, uint32_t numSlots) {
+std::vector<CKKSBootstrapConfig> FHECKKSRNS::PlanBootstrapKeySet(
+    const CryptoContextImpl<DCRTPoly>& cc, const std::vector<CKKSBootstrapConfig>& configs) const {
+    const uint32_t M = cc.GetCyclotomicOrder();
+
+    std::vector<CKKSBootstrapConfig> planned(configs);
+    for (auto& config : planned)
+        config.slots = (config.slots == 0) ? M / 4 : config.slots;
+
+    // the configurations with more slots need more keys, so they are planned first and the others adapt to them
+    std::vector<size_t> order(planned.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&planned](size_t i, size_t j) { return planned[i].slots > planned[j].slots; });
+
+    // baby steps to try for one transform: the default one first, so that it wins ties, then its power-of-two
+    // neighbors. A baby step chosen by the caller is kept.
+    auto candidates = [](const ckks_boot_params& p, uint32_t dim1, uint32_t gMax) {
+        if (dim1 != 0)
+            return std::vector<uint32_t>{dim1};
+        std::vector<uint32_t> gs{p.g};
+        if (p.g >= 4)
+            gs.push_back(p.g >> 1);
+        if ((p.g << 1) <= gMax)
+            gs.push_back(p.g << 1);
+        return gs;
+    };
+
+    std::set<int32_t> keySet;
+    for (size_t i : order) {
+        auto& config                      = planned[i];
+        const auto [paramsEnc, paramsDec] = GetBootstrapFFTParams(config);
+
+        // the linear-transform method uses the baby step for encoding in both transforms
+        const bool isLTBootstrap = (paramsEnc.lvlb == 1) && (paramsDec.lvlb == 1);
+        const auto gEnc = candidates(paramsEnc, config.dim1[0], isLTBootstrap ? config.slots : paramsEnc.numRotations);
+        const auto gDec = isLTBootstrap ? std::vector<uint32_t>{config.dim1[1]} :
+                                          candidates(paramsDec, config.dim1[1], paramsDec.numRotations);
+
+        // keep the choice that adds the fewest keys to the ones already planned
+        size_t minNewKeys = std::numeric_limits<size_t>::max();
+        std::vector<int32_t> bestIndices;
+        for (uint32_t ge : gEnc) {
+            for (uint32_t gd : gDec) {
+                auto indices = FindBootstrapRotationIndices(config.slots, M,
+                                                            GetCollapsedFFTParams(config.slots, paramsEnc.lvlb, ge),
+                                                            GetCollapsedFFTParams(config.slots, paramsDec.lvlb, gd));
+                size_t newKeys = std::count_if(indices.begin(), indices.end(),
+                                               [&keySet](int32_t index) { return keySet.count(index) == 0; });
+                if (newKeys < minNewKeys) {
+                    minNewKeys  = newKeys;
+                    bestIndices = std::move(indices);
+                    config.dim1 = {ge, gd};
+                }
+            }
+        }
+        keySet.insert(bestIndices.begin(), bestIndices.end());
+    }
+
+    return planned;
+}
+
+std::vector<int32_t> FHECKKSRNS::GetBootstrapRotationIndices(const CryptoContextImpl<DCRTPoly>& cc,
+                                                             const std::vector<CKKSBootstrapConfig>& configs) const {
+    const uint32_t M = cc.GetCyclotomicOrder();
+
+    std::set<int32_t> indices;
+    for (auto config : configs) {
+        config.slots                      = (config.slots == 0) ? M / 4 : config.slots;
+        const auto [paramsEnc, paramsDec] = GetBootstrapFFTParams(config);
+        auto tmp                          = FindBootstrapRotationIndices(config.slots, M, paramsEnc, paramsDec);
+        indices.insert(tmp.begin(), tmp.end());
+    }
+
+    return std::vector<int32_t>(indices.begin(), indices.end());
+}
+
+void FHECKKSRNS::EvalBootstrapPrecompute(const CryptoContextImpl<DCRTPoly>& cc, uint32_t numSlots,
+                                         bool compactPrecompute) {
     const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSRNS>(cc.GetCryptoParameters());
 
     if (cryptoParams->GetKeySwitchTechnique() != HYBRID)
@@ -314,7 +434,8 @@ void FHECKKSRNS::EvalBootstrapPrecompute(const CryptoContextImpl<DCRTPoly>& cc,
 
     auto& p = GetBootPrecom(slots);
 
-    p.m_paramsEnc = GetCollapsedFFTParams(slots, p.m_paramsEnc.lvlb, p.m_paramsEnc.g);
+    p.m_compactPrecompute = compactPrecompute;
+    p.m_paramsEnc         = GetCollapsedFFTParams(slots, p.m_paramsEnc.lvlb, p.m_paramsEnc.g);
     p.m_paramsDec = GetCollapsedFFTParams(slots, p.m_paramsDec.lvlb, p.m_paramsDec.g);
 
     uint32_t m     = 4 * slots;
@@ -426,6 +547,130 @@ void FHECKKSRNS::EvalBootstrapPrecompute(const CryptoContextImpl<DCRTPoly>& cc,
     }
 }
 
+std::string FHECKKSRNS::GetBootstrapPrecomputeFingerprint(const CryptoContextImpl<DCRTPoly>& cc,
+                                                          std::vector<uint32_t> levelBudget,
+                                                          std::vector<uint32_t> dim1, uint32_t numSlots,
+                                                          bool BTSlotsEncoding) const {
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSRNS>(cc.GetCryptoParameters());
+
+    uint32_t M     = cc.GetCyclotomicOrder();
+    uint32_t slots = (numSlots == 0) ? M / 4 : numSlots;
+
+    // the level budgets are clamped the same way as in EvalBootstrapSetup
+    uint32_t logSlots   = (slots < 3) ? 1 : std::log2(slots);
+    uint32_t newBudget0 = std::clamp<uint32_t>(levelBudget[0], 1, logSlots);
+    uint32_t newBudget1 = std::clamp<uint32_t>(levelBudget[1], 1, logSlots);
+    auto paramsEnc      = GetCollapsedFFTParams(slots, newBudget0, dim1[0]);
+    auto paramsDec      = GetCollapsedFFTParams(slots, newBudget1, dim1[1]);
+
+    std::stringstream s;
+    s << "N=" << cc.GetRingDimension() << ";Q=";
+    for (const auto& q : cryptoParams->GetElementParams()->GetParams())
+        s << q->GetModulus() << ",";
+    s << ";P=";
+    if (cryptoParams->GetParamsP() != nullptr) {
+        for (const auto& pj : cryptoParams->GetParamsP()->GetParams())
+            s << pj->GetModulus() << ",";
+    }
+    s << ";st=" << cryptoParams->GetScalingTechnique() << ";sk=" << cryptoParams->GetSecretKeyDist()
+      << ";cd=" << cryptoParams->GetCompositeDegree() << ";dt=" << cc.GetCKKSDataType()
+      << ";pt=" << cryptoParams->GetPlaintextModulus() << ";slots=" << slots << ";enc=" << paramsEnc.lvlb << ","
+      << paramsEnc.g << ";dec=" << paramsDec.lvlb << "," << paramsDec.g << ";bts=" << BTSlotsEncoding
+      << ";native=" << NATIVEINT;
+
+    return HashUtil::HashString(s.str());
+}
+
+std::shared_ptr<CKKSBootstrapPrecomData> FHECKKSRNS::ExportBootstrapPrecompute(const CryptoContextImpl<DCRTPoly>& cc,
+                                                                               uint32_t numSlots) const {
+    uint32_t M     = cc.GetCyclotomicOrder();
+    uint32_t slots = (numSlots == 0) ? M / 4 : numSlots;
+
+    const auto& p = GetBootPrecom(slots);
+    if (p.m_U0Pre.empty() && p.m_U0PreFFT.empty())
+        OPENFHE_THROW("Bootstrapping precomputations for " + std::to_string(slots) +
+                      " slots are not available. Call EvalBootstrapPrecompute() first.");
+    if (p.m_compactPrecompute)
+        OPENFHE_THROW("Compact bootstrapping precomputations can not be exported");
+
+    auto data                = std::make_shared<CKKSBootstrapPrecomData>();
+    data->m_fingerprint      = GetBootstrapPrecomputeFingerprint(cc, {p.m_paramsEnc.lvlb, p.m_paramsDec.lvlb},
+                                                                 {p.m_paramsEnc.g, p.m_paramsDec.g}, slots,
+                                                                 p.BTSlotsEncoding);
+    data->m_slots            = slots;
+    data->m_correctionFactor = m_correctionFactor;
+    data->m_lvlbEnc          = p.m_paramsEnc.lvlb;
+    data->m_lvlbDec          = p.m_paramsDec.lvlb;
+    data->m_gEnc             = p.m_paramsEnc.g;
+    data->m_gDec             = p.m_paramsDec.g;
+    data->m_BTSlotsEncoding  = p.BTSlotsEncoding;
+
+    data->m_U0Pre.reserve(p.m_U0Pre.size());
+    for (const auto& pt : p.m_U0Pre)
+        data->m_U0Pre.push_back(ExportPlaintext(pt));
+    data->m_U0hatTPre.reserve(p.m_U0hatTPre.size());
+    for (const auto& pt : p.m_U0hatTPre)
+        data->m_U0hatTPre.push_back(ExportPlaintext(pt));
+
+    data->m_U0PreFFT.resize(p.m_U0PreFFT.size());
+    for (size_t i = 0; i < p.m_U0PreFFT.size(); ++i) {
+        data->m_U0PreFFT[i].reserve(p.m_U0PreFFT[i].size());
+        for (const auto& pt : p.m_U0PreFFT[i])
+            data->m_U0PreFFT[i].push_back(ExportPlaintext(pt));
+    }
+    data->m_U0hatTPreFFT.resize(p.m_U0hatTPreFFT.size());
+    for (size_t i = 0; i < p.m_U0hatTPreFFT.size(); ++i) {
+        data->m_U0hatTPreFFT[i].reserve(p.m_U0hatTPreFFT[i].size());
+        for (const auto& pt : p.m_U0hatTPreFFT[i])
+            data->m_U0hatTPreFFT[i].push_back(ExportPlaintext(pt));
+    }
+
+    return data;
+}
+
+void FHECKKSRNS::ImportBootstrapPrecompute(const CryptoContextImpl<DCRTPoly>& cc,
+                                           const CKKSBootstrapPrecomData& data) {
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSRNS>(cc.GetCryptoParameters());
+
+    if (cryptoParams->GetKeySwitchTechnique() != HYBRID)
+        OPENFHE_THROW("CKKS Bootstrapping is only supported for the Hybrid key switching method.");
+
+    std::string fingerprint = GetBootstrapPrecomputeFingerprint(cc, {data.m_lvlbEnc, data.m_lvlbDec},
+                                                                {data.m_gEnc, data.m_gDec}, data.m_slots,
+                                                                data.m_BTSlotsEncoding);
+    if (fingerprint != data.m_fingerprint)
+        OPENFHE_THROW("Bootstrapping precomputations were generated for different parameters");
+
+    auto precom             = std::make_shared<CKKSBootstrapPrecom>();
+    precom->m_slots         = data.m_slots;
+    precom->BTSlotsEncoding = data.m_BTSlotsEncoding;
+    precom->m_paramsEnc     = GetCollapsedFFTParams(data.m_slots, data.m_lvlbEnc, data.m_gEnc);
+    precom->m_paramsDec     = GetCollapsedFFTParams(data.m_slots, data.m_lvlbDec, data.m_gDec);
+
+    precom->m_U0Pre.reserve(data.m_U0Pre.size());
+    for (const auto& pt : data.m_U0Pre)
+        precom->m_U0Pre.push_back(ImportPlaintext(cc, pt));
+    precom->m_U0hatTPre.reserve(data.m_U0hatTPre.size());
+    for (const auto& pt : data.m_U0hatTPre)
+        precom->m_U0hatTPre.push_back(ImportPlaintext(cc, pt));
+
+    precom->m_U0PreFFT.resize(data.m_U0PreFFT.size());
+    for (size_t i = 0; i < data.m_U0PreFFT.size(); ++i) {
+        precom->m_U0PreFFT[i].reserve(data.m_U0PreFFT[i].size());
+        for (const auto& pt : data.m_U0PreFFT[i])
+            precom->m_U0PreFFT[i].push_back(ImportPlaintext(cc, pt));
+    }
+    precom->m_U0hatTPreFFT.resize(data.m_U0hatTPreFFT.size());
+    for (size_t i = 0; i < data.m_U0hatTPreFFT.size(); ++i) {
+        precom->m_U0hatTPreFFT[i].reserve(data.m_U0hatTPreFFT[i].size());
+        for (const auto& pt : data.m_U0hatTPreFFT[i])
+            precom->m_U0hatTPreFFT[i].push_back(ImportPlaintext(cc, pt));
+    }
+
+    m_correctionFactor            = data.m_correctionFactor;
+    m_bootPrecomMap[data.m_slots] = std::move(precom);
+}
+
 Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrap(ConstCiphertext<DCRTPoly>& ciphertext, uint32_t numIterations,
                                                uint32_t precision) const {
     uint32_t slots = ciphertext->GetSlots();
@@ -438,25 +683,11 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrap(ConstCiphertext<DCRTPoly>& cipher
 
     const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSRNS>(ciphertext->GetCryptoParameters());
 
-    if (cryptoParams->GetKeySwitchTechnique() != HYBRID)
-        OPENFHE_THROW("CKKS Bootstrapping only supported with Hybrid key switching.");
-
     auto st = cryptoParams->GetScalingTechnique();
-#if NATIVEINT == 128
-    if (st == FLEXIBLEAUTO || st == FLEXIBLEAUTOEXT)
-        OPENFHE_THROW("128-bit CKKS Bootstrapping only supported for FIXEDMANUAL and FIXEDAUTO.");
-#endif
 
     if (numIterations != 1 && numIterations != 2)
         OPENFHE_THROW("CKKS Bootstrapping only supported for 1 or 2 iterations.");
 
-#ifdef BOOTSTRAPTIMING
-    TimeVar t;
-    double timeEncode(0.0);
-    double timeModReduce(0.0);
-    double timeDecode(0.0);
-#endif
-
     auto cc                  = ciphertext->GetCryptoContext();
     uint32_t L0              = cryptoParams->GetElementParams()->GetParams().size();
     auto initSizeQ           = ciphertext->GetElements()[0].GetNumOfElements();
@@ -512,6 +743,63 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrap(ConstCiphertext<DCRTPoly>& cipher
         return finalCiphertext;
     }
 
+    return EvalBootstrapInternal({ciphertext})[0];
+}
+
+std::vector<Ciphertext<DCRTPoly>> FHECKKSRNS::EvalBootstrapBatch(const std::vector<Ciphertext<DCRTPoly>>& ciphertexts,
+                                                                 uint32_t numIterations, uint32_t precision) const {
+    if (ciphertexts.empty())
+        OPENFHE_THROW("Input ciphertext vector is empty.");
+
+    const uint32_t slots = ciphertexts[0]->GetSlots();
+    const auto& keyTag   = ciphertexts[0]->GetKeyTag();
+    for (const auto& ciphertext : ciphertexts) {
+        if (ciphertext->GetSlots() != slots || ciphertext->GetKeyTag() != keyTag)
+            OPENFHE_THROW("All ciphertexts in a bootstrapping batch must have the same number of slots and key tag.");
+    }
+
+    // Meta-BTS and the StC-first variant refresh the ciphertexts one at a time
+    const uint32_t numCtxts = ciphertexts.size();
+    if (numCtxts == 1 || numIterations != 1 || GetBootPrecom(slots).BTSlotsEncoding) {
+        std::vector<Ciphertext<DCRTPoly>> result(numCtxts);
+        for (uint32_t i = 0; i < numCtxts; ++i)
+            result[i] = EvalBootstrap(ciphertexts[i], numIterations, precision);
+        return result;
+    }
+
+    return EvalBootstrapInternal(std::vector<ReadOnlyCiphertext<DCRTPoly>>(ciphertexts.begin(), ciphertexts.end()));
+}
+
+std::vector<Ciphertext<DCRTPoly>> FHECKKSRNS::EvalBootstrapInternal(
+    const std::vector<ReadOnlyCiphertext<DCRTPoly>>& ciphertexts) const {
+    const uint32_t numCtxts = ciphertexts.size();
+    const uint32_t slots    = ciphertexts[0]->GetSlots();
+    auto& p                 = GetBootPrecom(slots);
+
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSRNS>(ciphertexts[0]->GetCryptoParameters());
+
+    if (cryptoParams->GetKeySwitchTechnique() != HYBRID)
+        OPENFHE_THROW("CKKS Bootstrapping only supported with Hybrid key switching.");
+
+    auto st = cryptoParams->GetScalingTechnique();
+#if NATIVEINT == 128
+    if (st == FLEXIBLEAUTO || st == FLEXIBLEAUTOEXT)
+        OPENFHE_THROW("128-bit CKKS Bootstrapping only supported for FIXEDMANUAL and FIXEDAUTO.");
+#endif
+
+    PerfScope bootstrapScope(PerfOp::EVAL_BOOTSTRAP, numCtxts);
+
+#ifdef BOOTSTRAPTIMING
+    TimeVar t;
+    double timeEncode(0.0);
+    double timeModReduce(0.0);
+    double timeDecode(0.0);
+#endif
+
+    auto cc                  = ciphertexts[0]->GetCryptoContext();
+    uint32_t L0              = cryptoParams->GetElementParams()->GetParams().size();
+    uint32_t compositeDegree = cryptoParams->GetCompositeDegree();
+
     auto elementParamsRaised = *(cryptoParams->GetElementParams());
     // For FLEXIBLEAUTOEXT we raised ciphertext does not include extra modulus
     // as it is multiplied by auxiliary plaintext
@@ -546,69 +834,10 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrap(ConstCiphertext<DCRTPoly>& cipher
     uint64_t scalar = std::llround(post);
 
     //------------------------------------------------------------------------------
-    // RAISING THE MODULUS
+    // SETTING PARAMETERS FOR APPROXIMATE MODULAR REDUCTION
     //------------------------------------------------------------------------------
 
-    // In FLEXIBLEAUTO, raising the ciphertext to a larger number
-    // of towers is a bit more complex, because we need to adjust
-    // it's scaling factor to the one that corresponds to the level
-    // it's being raised to.
-    // Increasing the modulus
-
-    auto raised = ciphertext->Clone();
-    auto algo   = cc->GetScheme();
-    algo->ModReduceInternalInPlace(raised, compositeDegree * (raised->GetNoiseScaleDeg() - 1));
-    uint32_t lvl = cryptoParams->GetScalingTechnique() != FLEXIBLEAUTOEXT ? 0 : 1;
-    AdjustCiphertext(raised, std::pow(2, -static_cast<int32_t>(correction)), lvl);
-
     uint32_t N = cc->GetRingDimension();
-    if (compositeDegree > 1) {
-        // RNS basis extension from level 0 RNS limbs to the raised RNS basis
-        auto& ctxtDCRTs = raised->GetElements();
-        ExtendCiphertext(ctxtDCRTs, *cc, elementParamsRaisedPtr);
-        raised->SetLevel(L0 - ctxtDCRTs[0].GetNumOfElements());
-    }
-    else {
-        if (cryptoParams->GetSecretKeyDist() == SPARSE_ENCAPSULATED) {
-            auto& evalKeyMap = cc->GetEvalAutomorphismKeyMap(raised->GetKeyTag());
-
-            // transform from a denser secret to a sparser one
-            raised = KeySwitchSparse(raised, evalKeyMap.at(2 * N - 4));
-
-            // Only level 0 ciphertext used here. Other towers ignored to make CKKS bootstrapping faster.
-            auto& ctxtDCRTs = raised->GetElements();
-            for (auto& dcrt : ctxtDCRTs) {
-                dcrt.SetFormat(COEFFICIENT);
-                DCRTPoly tmp(dcrt.GetElementAtIndex(0), elementParamsRaisedPtr);
-                tmp.SetFormat(EVALUATION);
-                dcrt = std::move(tmp);
-            }
-            raised->SetLevel(L0 - ctxtDCRTs[0].GetNumOfElements());
-
-            // go back to a denser secret
-            algo->KeySwitchInPlace(raised, evalKeyMap.at(2 * N - 2));
-        }
-        else {
-            // Only level 0 ciphertext used here. Other towers ignored to make CKKS bootstrapping faster.
-            auto& ctxtDCRTs = raised->GetElements();
-            for (auto& dcrt : ctxtDCRTs) {
-                dcrt.SetFormat(COEFFICIENT);
-                DCRTPoly tmp(dcrt.GetElementAtIndex(0), elementParamsRaisedPtr);
-                tmp.SetFormat(EVALUATION);
-                dcrt = std::move(tmp);
-            }
-            raised->SetLevel(L0 - ctxtDCRTs[0].GetNumOfElements());
-        }
-    }
-
-#ifdef BOOTSTRAPTIMING
-    std::cerr << "\nNumber of levels at the beginning of bootstrapping: "
-              << raised->GetElements()[0].GetNumOfElements() - 1 << std::endl;
-#endif
-
-    //------------------------------------------------------------------------------
-    // SETTING PARAMETERS FOR APPROXIMATE MODULAR REDUCTION
-    //------------------------------------------------------------------------------
 
     // Coefficients of the Chebyshev series interpolating 1/(2 Pi) Sin(2 Pi K x)
     std::vector<double> coefficients;
@@ -635,15 +864,79 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrap(ConstCiphertext<DCRTPoly>& cipher
         }
     }
 
-    cc->EvalMultInPlace(raised, pre * (1.0 / (k * N)));
-
     // no linear transformations are needed for Chebyshev series as the range has been normalized to [-1,1]
     double coeffLowerBound = -1.0;
     double coeffUpperBound = 1.0;
 
+    //------------------------------------------------------------------------------
+    // RAISING THE MODULUS
+    //------------------------------------------------------------------------------
+
+    // In FLEXIBLEAUTO, raising the ciphertext to a larger number
+    // of towers is a bit more complex, because we need to adjust
+    // it's scaling factor to the one that corresponds to the level
+    // it's being raised to.
+    // Increasing the modulus
+
+    auto algo    = cc->GetScheme();
+    uint32_t lvl = cryptoParams->GetScalingTechnique() != FLEXIBLEAUTOEXT ? 0 : 1;
+
+    // the keys are looked up once for the whole batch
+    auto& evalKeyMap = cc->GetEvalAutomorphismKeyMap(ciphertexts[0]->GetKeyTag());
+    EvalKey<DCRTPoly> keySparse, keyDense;
+    if (compositeDegree == 1 && cryptoParams->GetSecretKeyDist() == SPARSE_ENCAPSULATED) {
+        keySparse = evalKeyMap.at(2 * N - 4);
+        keyDense  = evalKeyMap.at(2 * N - 2);
+    }
+
+    PerfScope modRaiseScope(PerfOp::BOOT_MOD_RAISE, numCtxts);
+    std::vector<Ciphertext<DCRTPoly>> raised(numCtxts);
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCtxts))
+    for (uint32_t i = 0; i < numCtxts; ++i) {
+        raised[i] = ciphertexts[i]->Clone();
+        algo->ModReduceInternalInPlace(raised[i], compositeDegree * (raised[i]->GetNoiseScaleDeg() - 1));
+        AdjustCiphertext(raised[i], std::pow(2, -static_cast<int32_t>(correction)), lvl);
+
+        if (compositeDegree > 1) {
+            // RNS basis extension from level 0 RNS limbs to the raised RNS basis
+            auto& ctxtDCRTs = raised[i]->GetElements();
+            ExtendCiphertext(ctxtDCRTs, *cc, elementParamsRaisedPtr);
+            raised[i]->SetLevel(L0 - ctxtDCRTs[0].GetNumOfElements());
+        }
+        else {
+            // transform from a denser secret to a sparser one
+            if (keySparse)
+                raised[i] = KeySwitchSparse(raised[i], keySparse);
+
+            // Only level 0 ciphertext used here. Other towers ignored to make CKKS bootstrapping faster.
+            auto& ctxtDCRTs = raised[i]->GetElements();
+            for (auto& dcrt : ctxtDCRTs) {
+                dcrt.SetFormat(COEFFICIENT);
+                DCRTPoly tmp(dcrt.GetElementAtIndex(0), elementParamsRaisedPtr);
+                tmp.SetFormat(EVALUATION);
+                dcrt = std::move(tmp);
+            }
+            raised[i]->SetLevel(L0 - ctxtDCRTs[0].GetNumOfElements());
+
+            // go back to a denser secret
+            if (keyDense)
+                algo->KeySwitchInPlace(raised[i], keyDense);
+        }
+
+        cc->EvalMultInPlace(raised[i], pre * (1.0 / (k * N)));
+    }
+    modRaiseScope.Stop();
+
+#ifdef BOOTSTRAPTIMING
+    std::cerr << "\nNumber of levels at the beginning of bootstrapping: "
+              << raised[0]->GetElements()[0].GetNumOfElements() - 1 << std::endl;
+#endif
+
     bool isLTBootstrap = (p.m_paramsEnc.lvlb == 1) && (p.m_paramsDec.lvlb == 1);
 
-    Ciphertext<DCRTPoly> ctxtDec;
+    uint32_t numIter = (cryptoParams->GetSecretKeyDist() == UNIFORM_TERNARY) ? R_UNIFORM : R_SPARSE;
+
+    std::vector<Ciphertext<DCRTPoly>> ctxtDec;
     if (slots == cc->GetCyclotomicOrder() / 4) {
         //------------------------------------------------------------------------------
         // FULLY PACKED CASE
@@ -657,60 +950,71 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrap(ConstCiphertext<DCRTPoly>& cipher
         // Running CoeffToSlot
         //------------------------------------------------------------------------------
 
+        PerfScope coeffsToSlotsScope(PerfOp::BOOT_COEFFS_TO_SLOTS, numCtxts);
+
         // need to call internal modular reduction so it also works for FLEXIBLEAUTO
-        algo->ModReduceInternalInPlace(raised, compositeDegree);
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCtxts))
+        for (uint32_t i = 0; i < numCtxts; ++i)
+            algo->ModReduceInternalInPlace(raised[i], compositeDegree);
 
         // only one linear transform is needed as the other one can be derived
-        auto ctxtEnc =
-            (isLTBootstrap) ? EvalLinearTransform(p.m_U0hatTPre, raised) : EvalCoeffsToSlots(p.m_U0hatTPreFFT, raised);
+        std::vector<ReadOnlyCiphertext<DCRTPoly>> ctxtRaised(raised.begin(), raised.end());
+        auto ctxtEnc = (isLTBootstrap) ? EvalLinearTransformBatch(p.m_U0hatTPre, ctxtRaised) :
+                                         EvalCoeffsToSlotsBatch(p.m_U0hatTPreFFT, ctxtRaised);
+        coeffsToSlotsScope.Stop();
 
-        auto& evalKeyMap = cc->GetEvalAutomorphismKeyMap(ctxtEnc->GetKeyTag());
-        auto conj        = Conjugate(ctxtEnc, evalKeyMap);
-        auto ctxtEncI    = cc->EvalSub(ctxtEnc, conj);
-        cc->EvalAddInPlace(ctxtEnc, conj);
-        algo->MultByMonomialInPlace(ctxtEncI, 3 * slots);
+        //------------------------------------------------------------------------------
+        // Running Approximate Mod Reduction
+        //------------------------------------------------------------------------------
 
-        if (st == FIXEDMANUAL) {
-            while (ctxtEnc->GetNoiseScaleDeg() > 1) {
-                cc->ModReduceInPlace(ctxtEnc);
-                cc->ModReduceInPlace(ctxtEncI);
+        PerfScope evalModScope(PerfOp::BOOT_EVAL_MOD, numCtxts);
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCtxts))
+        for (uint32_t i = 0; i < numCtxts; ++i) {
+            auto& ctxtEncR = ctxtEnc[i];
+            auto conj      = Conjugate(ctxtEncR, evalKeyMap);
+            auto ctxtEncI  = cc->EvalSub(ctxtEncR, conj);
+            cc->EvalAddInPlace(ctxtEncR, conj);
+            algo->MultByMonomialInPlace(ctxtEncI, 3 * slots);
+
+            if (st == FIXEDMANUAL) {
+                while (ctxtEncR->GetNoiseScaleDeg() > 1) {
+                    cc->ModReduceInPlace(ctxtEncR);
+                    cc->ModReduceInPlace(ctxtEncI);
+                }
             }
-        }
-        else {
-            if (ctxtEnc->GetNoiseScaleDeg() == 2) {
-                algo->ModReduceInternalInPlace(ctxtEnc, compositeDegree);
-                algo->ModReduceInternalInPlace(ctxtEncI, compositeDegree);
+            else {
+                if (ctxtEncR->GetNoiseScaleDeg() == 2) {
+                    algo->ModReduceInternalInPlace(ctxtEncR, compositeDegree);
+                    algo->ModReduceInternalInPlace(ctxtEncI, compositeDegree);
+                }
             }
-        }
 
-        //------------------------------------------------------------------------------
-        // Running Approximate Mod Reduction
-        //------------------------------------------------------------------------------
+            // Evaluate Chebyshev series for the sine wave
+            ctxtEncR = algo->EvalChebyshevSeries(ctxtEncR, coefficients, coeffLowerBound, coeffUpperBound);
+            ctxtEncI = algo->EvalChebyshevSeries(ctxtEncI, coefficients, coeffLowerBound, coeffUpperBound);
 
-        // Evaluate Chebyshev series for the sine wave
-        ctxtEnc  = algo->EvalChebyshevSeries(ctxtEnc, coefficients, coeffLowerBound, coeffUpperBound);
-        ctxtEncI = algo->EvalChebyshevSeries(ctxtEncI, coefficients, coeffLowerBound, coeffUpperBound);
+            // Double-angle iterations
+            if (st != FIXEDMANUAL) {
+                algo->ModReduceInternalInPlace(ctxtEncR, compositeDegree);
+                algo->ModReduceInternalInPlace(ctxtEncI, compositeDegree);
+            }
+            ApplyDoubleAngleIterations(ctxtEncR, numIter);
+            ApplyDoubleAngleIterations(ctxtEncI, numIter);
 
-        // Double-angle iterations
-        if (st != FIXEDMANUAL) {
-            algo->ModReduceInternalInPlace(ctxtEnc, compositeDegree);
-            algo->ModReduceInternalInPlace(ctxtEncI, compositeDegree);
-        }
-        uint32_t numIter;
-        if (cryptoParams->GetSecretKeyDist() == UNIFORM_TERNARY)
-            numIter = R_UNIFORM;
-        else
-            numIter = R_SPARSE;
-        ApplyDoubleAngleIterations(ctxtEnc, numIter);
-        ApplyDoubleAngleIterations(ctxtEncI, numIter);
+            algo->MultByMonomialInPlace(ctxtEncI, slots);
+            cc->EvalAddInPlaceNoCheck(ctxtEncR, ctxtEncI);
 
-        algo->MultByMonomialInPlace(ctxtEncI, slots);
-        cc->EvalAddInPlaceNoCheck(ctxtEnc, ctxtEncI);
+            if (st != COMPOSITESCALINGAUTO && st != COMPOSITESCALINGMANUAL) {
+                // scale the message back up after Chebyshev interpolation
+                algo->MultByIntegerInPlace(ctxtEncR, scalar);
+            }
 
-        if (st != COMPOSITESCALINGAUTO && st != COMPOSITESCALINGMANUAL) {
-            // scale the message back up after Chebyshev interpolation
-            algo->MultByIntegerInPlace(ctxtEnc, scalar);
+            // In the case of FLEXIBLEAUTO, we need one extra tower
+            // TODO: See if we can remove the extra level in FLEXIBLEAUTO
+            if (st != FIXEDMANUAL)
+                algo->ModReduceInternalInPlace(ctxtEncR, compositeDegree);
         }
+        evalModScope.Stop();
 
 #ifdef BOOTSTRAPTIMING
         timeModReduce = TOC(t);
@@ -723,13 +1027,11 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrap(ConstCiphertext<DCRTPoly>& cipher
         // Running SlotToCoeff
         //------------------------------------------------------------------------------
 
-        // In the case of FLEXIBLEAUTO, we need one extra tower
-        // TODO: See if we can remove the extra level in FLEXIBLEAUTO
-        if (st != FIXEDMANUAL)
-            algo->ModReduceInternalInPlace(ctxtEnc, compositeDegree);
-
         // Only one linear transform is needed
-        ctxtDec = (isLTBootstrap) ? EvalLinearTransform(p.m_U0Pre, ctxtEnc) : EvalSlotsToCoeffs(p.m_U0PreFFT, ctxtEnc);
+        PerfScope slotsToCoeffsScope(PerfOp::BOOT_SLOTS_TO_COEFFS, numCtxts);
+        std::vector<ReadOnlyCiphertext<DCRTPoly>> ctxtMod(ctxtEnc.begin(), ctxtEnc.end());
+        ctxtDec = (isLTBootstrap) ? EvalLinearTransformBatch(p.m_U0Pre, ctxtMod) :
+                                    EvalSlotsToCoeffsBatch(p.m_U0PreFFT, ctxtMod);
     }
     else {
         //------------------------------------------------------------------------------
@@ -740,9 +1042,14 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrap(ConstCiphertext<DCRTPoly>& cipher
         // Running PartialSum
         //------------------------------------------------------------------------------
 
+        PerfScope coeffsToSlotsScope(PerfOp::BOOT_COEFFS_TO_SLOTS, numCtxts);
+
         const auto limit = N / (2 * slots);
-        for (uint32_t j = 1; j < limit; j <<= 1)
-            cc->EvalAddInPlace(raised, cc->EvalRotate(raised, j * slots));
+        for (uint32_t j = 1; j < limit; j <<= 1) {
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCtxts))
+            for (uint32_t i = 0; i < numCtxts; ++i)
+                cc->EvalAddInPlace(raised[i], cc->EvalRotate(raised[i], j * slots));
+        }
 
 #ifdef BOOTSTRAPTIMING
         TIC(t);
@@ -752,24 +1059,30 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrap(ConstCiphertext<DCRTPoly>& cipher
         // Running CoeffsToSlots
         //------------------------------------------------------------------------------
 
-        algo->ModReduceInternalInPlace(raised, compositeDegree);
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCtxts))
+        for (uint32_t i = 0; i < numCtxts; ++i)
+            algo->ModReduceInternalInPlace(raised[i], compositeDegree);
 
-        auto ctxtEnc =
-            (isLTBootstrap) ? EvalLinearTransform(p.m_U0hatTPre, raised) : EvalCoeffsToSlots(p.m_U0hatTPreFFT, raised);
+        std::vector<ReadOnlyCiphertext<DCRTPoly>> ctxtRaised(raised.begin(), raised.end());
+        auto ctxtEnc = (isLTBootstrap) ? EvalLinearTransformBatch(p.m_U0hatTPre, ctxtRaised) :
+                                         EvalCoeffsToSlotsBatch(p.m_U0hatTPreFFT, ctxtRaised);
 
-        auto& evalKeyMap = cc->GetEvalAutomorphismKeyMap(ctxtEnc->GetKeyTag());
-        cc->EvalAddInPlace(ctxtEnc, Conjugate(ctxtEnc, evalKeyMap));
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCtxts))
+        for (uint32_t i = 0; i < numCtxts; ++i) {
+            cc->EvalAddInPlace(ctxtEnc[i], Conjugate(ctxtEnc[i], evalKeyMap));
 
-        if (st == FIXEDMANUAL) {
-            while (ctxtEnc->GetNoiseScaleDeg() > 1) {
-                cc->ModReduceInPlace(ctxtEnc);
+            if (st == FIXEDMANUAL) {
+                while (ctxtEnc[i]->GetNoiseScaleDeg() > 1) {
+                    cc->ModReduceInPlace(ctxtEnc[i]);
+                }
             }
-        }
-        else {
-            if (ctxtEnc->GetNoiseScaleDeg() == 2) {
-                algo->ModReduceInternalInPlace(ctxtEnc, compositeDegree);
+            else {
+                if (ctxtEnc[i]->GetNoiseScaleDeg() == 2) {
+                    algo->ModReduceInternalInPlace(ctxtEnc[i], compositeDegree);
+                }
             }
         }
+        coeffsToSlotsScope.Stop();
 
 #ifdef BOOTSTRAPTIMING
         timeEncode = TOC(t);
@@ -782,20 +1095,29 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrap(ConstCiphertext<DCRTPoly>& cipher
         // Running Approximate Mod Reduction
         //------------------------------------------------------------------------------
 
-        // Evaluate Chebyshev series for the sine wave
-        ctxtEnc = algo->EvalChebyshevSeries(ctxtEnc, coefficients, coeffLowerBound, coeffUpperBound);
-
-        // Double-angle iterations
-        if (st != FIXEDMANUAL)
-            algo->ModReduceInternalInPlace(ctxtEnc, compositeDegree);
-        uint32_t numIter = (cryptoParams->GetSecretKeyDist() == UNIFORM_TERNARY) ? R_UNIFORM : R_SPARSE;
-        ApplyDoubleAngleIterations(ctxtEnc, numIter);
+        PerfScope evalModScope(PerfOp::BOOT_EVAL_MOD, numCtxts);
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCtxts))
+        for (uint32_t i = 0; i < numCtxts; ++i) {
+            // Evaluate Chebyshev series for the sine wave
+            ctxtEnc[i] = algo->EvalChebyshevSeries(ctxtEnc[i], coefficients, coeffLowerBound, coeffUpperBound);
+
+            // Double-angle iterations
+            if (st != FIXEDMANUAL)
+                algo->ModReduceInternalInPlace(ctxtEnc[i], compositeDegree);
+            ApplyDoubleAngleIterations(ctxtEnc[i], numIter);
+
+            // TODO: YSP Can be extended to FLEXIBLE* scaling techniques as well as the closeness of 2^p to moduli is no longer needed
+            if (st != COMPOSITESCALINGAUTO && st != COMPOSITESCALINGMANUAL) {
+                // scale the message back up after Chebyshev interpolation
+                algo->MultByIntegerInPlace(ctxtEnc[i], scalar);
+            }
 
-        // TODO: YSP Can be extended to FLEXIBLE* scaling techniques as well as the closeness of 2^p to moduli is no longer needed
-        if (st != COMPOSITESCALINGAUTO && st != COMPOSITESCALINGMANUAL) {
-            // scale the message back up after Chebyshev interpolation
-            algo->MultByIntegerInPlace(ctxtEnc, scalar);
+            // In the case of FLEXIBLEAUTO, we need one extra tower
+            // TODO: See if we can remove the extra level in FLEXIBLEAUTO
+            if (st != FIXEDMANUAL)
+                algo->ModReduceInternalInPlace(ctxtEnc[i], compositeDegree);
         }
+        evalModScope.Stop();
 
 #ifdef BOOTSTRAPTIMING
         timeModReduce = TOC(t);
@@ -808,31 +1130,38 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrap(ConstCiphertext<DCRTPoly>& cipher
         // Running SlotsToCoeffs
         //------------------------------------------------------------------------------
 
-        // In the case of FLEXIBLEAUTO, we need one extra tower
-        // TODO: See if we can remove the extra level in FLEXIBLEAUTO
-        if (st != FIXEDMANUAL)
-            algo->ModReduceInternalInPlace(ctxtEnc, compositeDegree);
-
         // linear transform for decoding
-        ctxtDec = (isLTBootstrap) ? EvalLinearTransform(p.m_U0Pre, ctxtEnc) : EvalSlotsToCoeffs(p.m_U0PreFFT, ctxtEnc);
-        cc->EvalAddInPlaceNoCheck(ctxtDec, cc->EvalRotate(ctxtDec, slots));
+        PerfScope slotsToCoeffsScope(PerfOp::BOOT_SLOTS_TO_COEFFS, numCtxts);
+        std::vector<ReadOnlyCiphertext<DCRTPoly>> ctxtMod(ctxtEnc.begin(), ctxtEnc.end());
+        ctxtDec = (isLTBootstrap) ? EvalLinearTransformBatch(p.m_U0Pre, ctxtMod) :
+                                    EvalSlotsToCoeffsBatch(p.m_U0PreFFT, ctxtMod);
+
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCtxts))
+        for (uint32_t i = 0; i < numCtxts; ++i)
+            cc->EvalAddInPlaceNoCheck(ctxtDec[i], cc->EvalRotate(ctxtDec[i], slots));
     }
 
 #if NATIVEINT != 128
     // 64-bit only: scale back the message to its original scale.
     uint64_t corFactor = static_cast<uint64_t>(1) << std::llround(correction);
-    algo->MultByIntegerInPlace(ctxtDec, corFactor);
 #endif
 
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCtxts))
+    for (uint32_t i = 0; i < numCtxts; ++i) {
+#if NATIVEINT != 128
+        algo->MultByIntegerInPlace(ctxtDec[i], corFactor);
+#endif
+        // If we start with more towers, than we obtain from bootstrapping, return the original ciphertext.
+        if (ctxtDec[i]->GetElements()[0].GetNumOfElements() <= ciphertexts[i]->GetElements()[0].GetNumOfElements())
+            ctxtDec[i] = ciphertexts[i]->Clone();
+    }
+
 #ifdef BOOTSTRAPTIMING
     timeDecode = TOC(t);
 
     std::cout << "Decoding time: " << timeDecode / 1000.0 << " s" << std::endl;
 #endif
 
-    // If we start with more towers, than we obtain from bootstrapping, return the original ciphertext.
-    if (ctxtDec->GetElements()[0].GetNumOfElements() <= initSizeQ)
-        return ciphertext->Clone();
     return ctxtDec;
 }
 
@@ -918,6 +1247,8 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrapStCFirst(ConstCiphertext<DCRTPoly>
         return finalCiphertext;
     }
 
+    PerfScope bootstrapScope(PerfOp::EVAL_BOOTSTRAP);
+
     uint32_t slots           = ciphertext->GetSlots();
     auto elementParamsRaised = *(cryptoParams->GetElementParams());
     // For FLEXIBLEAUTOEXT we raised ciphertext does not include extra modulus
@@ -1037,6 +1368,7 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrapStCFirst(ConstCiphertext<DCRTPoly>
     //------------------------------------------------------------------------------
 
     // Linear transform for decoding
+    PerfScope slotsToCoeffsScope(PerfOp::BOOT_SLOTS_TO_COEFFS);
     ctxtDepleted =
         (isLTBootstrap) ? EvalLinearTransform(p.m_U0Pre, ctxtDepleted) : EvalSlotsToCoeffs(p.m_U0PreFFT, ctxtDepleted);
 
@@ -1046,6 +1378,7 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrapStCFirst(ConstCiphertext<DCRTPoly>
         //------------------------------------------------------------------------------
         cc->EvalAddInPlaceNoCheck(ctxtDepleted, cc->EvalRotate(ctxtDepleted, slots));
     }
+    slotsToCoeffsScope.Stop();
 
 #ifdef BOOTSTRAPTIMING
     timeDecode = TOC(t);
@@ -1063,6 +1396,7 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrapStCFirst(ConstCiphertext<DCRTPoly>
     // it's being raised to.
     // Increasing the modulus
 
+    PerfScope modRaiseScope(PerfOp::BOOT_MOD_RAISE);
     auto raised = ctxtDepleted->Clone();
     algo->ModReduceInternalInPlace(raised, compositeDegree * (raised->GetNoiseScaleDeg() - 1));
     uint32_t lvl = cryptoParams->GetScalingTechnique() != FLEXIBLEAUTOEXT ? 0 : 1;
@@ -1113,7 +1447,9 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrapStCFirst(ConstCiphertext<DCRTPoly>
     double normalization = pre * (1.0 / (k * N));
     // Scaling adjustment before Coefficient to Slots
     cc->EvalMultInPlace(raised, normalization);
+    modRaiseScope.Stop();
 
+    PerfScope coeffsToSlotsScope(PerfOp::BOOT_COEFFS_TO_SLOTS);
     if (slots != N / 2) {
         //------------------------------------------------------------------------------
         // SPARSELY PACKED CASE
@@ -1175,6 +1511,9 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrapStCFirst(ConstCiphertext<DCRTPoly>
     // Running Approximate Mod Reduction
     //------------------------------------------------------------------------------
 
+    coeffsToSlotsScope.Stop();
+    PerfScope evalModScope(PerfOp::BOOT_EVAL_MOD);
+
     // Evaluate Chebyshev series for the sine wave
     ctxtEnc = algo->EvalChebyshevSeries(ctxtEnc, coefficients, coeffLowerBound, coeffUpperBound);
     // AA: Note that for sparse complex, we currently evaluate the polynomial over two ciphertexts.
@@ -1204,6 +1543,7 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrapStCFirst(ConstCiphertext<DCRTPoly>
         // scale the message back up after Chebyshev interpolation
         algo->MultByIntegerInPlace(ctxtEnc, scalar);
     }
+    evalModScope.Stop();
 
 #ifdef BOOTSTRAPTIMING
     timeModReduce = TOC(t);
@@ -1229,19 +1569,36 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrapStCFirst(ConstCiphertext<DCRTPoly>
 // Find Rotation Indices
 //------------------------------------------------------------------------------
 
+std::pair<ckks_boot_params, ckks_boot_params> FHECKKSRNS::GetBootstrapFFTParams(const CKKSBootstrapConfig& config) {
+    if (config.levelBudget.size() != 2 || config.dim1.size() != 2)
+        OPENFHE_THROW("The level budget and dim1 of a bootstrapping configuration must have two elements each.");
+
+    // even for the case of a single slot we need one level for rescaling
+    const uint32_t logSlots = (config.slots < 3) ? 1 : std::log2(config.slots);
+    const uint32_t lvlbEnc  = std::clamp<uint32_t>(config.levelBudget[0], 1, logSlots);
+    const uint32_t lvlbDec  = std::clamp<uint32_t>(config.levelBudget[1], 1, logSlots);
+    return {GetCollapsedFFTParams(config.slots, lvlbEnc, config.dim1[0]),
+            GetCollapsedFFTParams(config.slots, lvlbDec, config.dim1[1])};
+}
+
 std::vector<int32_t> FHECKKSRNS::FindBootstrapRotationIndices(uint32_t slots, uint32_t M) {
     const auto& p = GetBootPrecom(slots);
+    return FindBootstrapRotationIndices(slots, M, p.m_paramsEnc, p.m_paramsDec);
+}
 
+std::vector<int32_t> FHECKKSRNS::FindBootstrapRotationIndices(uint32_t slots, uint32_t M,
+                                                              const ckks_boot_params& paramsEnc,
+                                                              const ckks_boot_params& paramsDec) {
     // Remove possible duplicates and remove automorphisms corresponding to 0 and M/4 by using std::set
     std::set<uint32_t> s;
-    if (p.m_paramsEnc.lvlb == 1 && p.m_paramsDec.lvlb == 1) {
-        auto tmp = FindLinearTransformRotationIndices(slots, M);
+    if (paramsEnc.lvlb == 1 && paramsDec.lvlb == 1) {
+        auto tmp = FindLinearTransformRotationIndices(slots, M, paramsEnc);
         s.insert(tmp.begin(), tmp.end());
     }
     else {
-        auto tmp = FindCoeffsToSlotsRotationIndices(slots, M);
+        auto tmp = FindCoeffsToSlotsRotationIndices(slots, M, paramsEnc);
         s.insert(tmp.begin(), tmp.end());
-        tmp = FindSlotsToCoeffsRotationIndices(slots, M);
+        tmp = FindSlotsToCoeffsRotationIndices(slots, M, paramsDec);
         s.insert(tmp.begin(), tmp.end());
     }
     s.insert(static_cast<uint32_t>(slots));
@@ -1254,10 +1611,10 @@ std::vector<int32_t> FHECKKSRNS::FindBootstrapRotationIndices(uint32_t slots, ui
 // ATTN: This function is a helper methods to be called in FindBootstrapRotationIndices() only.
 // so it DOES NOT remove possible duplicates and automorphisms corresponding to 0 and M/4.
 // This method completely depends on FindBootstrapRotationIndices() to do that.
-std::vector<uint32_t> FHECKKSRNS::FindLinearTransformRotationIndices(uint32_t slots, uint32_t M) {
+std::vector<uint32_t> FHECKKSRNS::FindLinearTransformRotationIndices(uint32_t slots, uint32_t M,
+                                                                     const ckks_boot_params& p) {
     // Computing the baby-step g and the giant-step h.
-    const auto& p    = GetBootPrecom(slots);
-    const uint32_t g = (p.m_paramsEnc.g == 0) ? std::ceil(std::sqrt(slots)) : p.m_paramsEnc.g;
+    const uint32_t g = (p.g == 0) ? std::ceil(std::sqrt(slots)) : p.g;
     const uint32_t h = std::ceil(static_cast<double>(slots) / g);
 
     // To avoid overflowing uint32_t variables, we do some math operations below in a specific order
@@ -1286,9 +1643,8 @@ std::vector<uint32_t> FHECKKSRNS::FindLinearTransformRotationIndices(uint32_t sl
 // ATTN: This function is a helper methods to be called in FindBootstrapRotationIndices() only.
 // so it DOES NOT remove possible duplicates and automorphisms corresponding to 0 and M/4.
 // This method completely depends on FindBootstrapRotationIndices() to do that.
-std::vector<uint32_t> FHECKKSRNS::FindCoeffsToSlotsRotationIndices(uint32_t slots, uint32_t M) {
-    const auto& p = GetBootPrecom(slots).m_paramsEnc;
-
+std::vector<uint32_t> FHECKKSRNS::FindCoeffsToSlotsRotationIndices(uint32_t slots, uint32_t M,
+                                                                   const ckks_boot_params& p) {
     // To avoid overflowing uint32_t variables, we do some math operations below in a specific order
     // Computing all indices for baby-step giant-step procedure for encoding and decoding
     const int32_t indexListSz = static_cast<int32_t>(p.b) + p.g - 2 + p.bRem + p.gRem - 2 + 1 + M;
@@ -1328,9 +1684,8 @@ std::vector<uint32_t> FHECKKSRNS::FindCoeffsToSlotsRotationIndices(uint32_t slot
     return indexList;
 }
 
-std::vector<uint32_t> FHECKKSRNS::FindSlotsToCoeffsRotationIndices(uint32_t slots, uint32_t M) {
-    const auto& p = GetBootPrecom(slots).m_paramsDec;
-
+std::vector<uint32_t> FHECKKSRNS::FindSlotsToCoeffsRotationIndices(uint32_t slots, uint32_t M,
+                                                                   const ckks_boot_params& p) {
     // To avoid overflowing uint32_t variables, we do some math operations below in a specific order
     // Computing all indices for baby-step giant-step procedure for encoding and decoding
     const int32_t indexListSz = static_cast<int32_t>(p.b) + p.g - 2 + p.bRem + p.gRem - 2 + 1 + M;
@@ -1409,6 +1764,8 @@ std::vector<ReadOnlyPlaintext> FHECKKSRNS::EvalLinearTransformPrecompute(
 
     auto g = GetBootPrecom(slots).m_paramsEnc.g;
 
+    const auto makeAuxPlaintext = GetBootPrecom(slots).m_compactPrecompute ? MakeCompactAuxPlaintext : MakeAuxPlaintext;
+
     const int32_t step = (g == 0) ? std::ceil(std::sqrt(slots)) : g;
 
     std::vector<ReadOnlyPlaintext> result(slots);
@@ -1420,7 +1777,7 @@ std::vector<ReadOnlyPlaintext> FHECKKSRNS::EvalLinearTransformPrecompute(
         for (auto& d : diag)
             d *= scale;
         result[ji] =
-            MakeAuxPlaintext(cc, elementParamsPtr, Rotate(diag, -step * (ji / step)), 1, towersToDrop, diag.size());
+            makeAuxPlaintext(cc, elementParamsPtr, Rotate(diag, -step * (ji / step)), 1, towersToDrop, diag.size());
     }
     return result;
 }
@@ -1457,6 +1814,8 @@ std::vector<ReadOnlyPlaintext> FHECKKSRNS::EvalLinearTransformPrecompute(
 
     auto g = GetBootPrecom(slots).m_paramsEnc.g;
 
+    const auto makeAuxPlaintext = GetBootPrecom(slots).m_compactPrecompute ? MakeCompactAuxPlaintext : MakeAuxPlaintext;
+
     const int32_t step = (g == 0) ? std::ceil(std::sqrt(slots)) : g;
 
     std::vector<ReadOnlyPlaintext> result(slots);
@@ -1473,7 +1832,7 @@ std::vector<ReadOnlyPlaintext> FHECKKSRNS::EvalLinearTransformPrecompute(
             for (auto& v : vecA)
                 v *= scale;
             result[ji] =
-                MakeAuxPlaintext(cc, elementParamsPtr, Rotate(vecA, -step * (ji / step)), 1, towersToDrop, vecA.size());
+                makeAuxPlaintext(cc, elementParamsPtr, Rotate(vecA, -step * (ji / step)), 1, towersToDrop, vecA.size());
         }
     }
     else {
@@ -1497,7 +1856,7 @@ std::vector<ReadOnlyPlaintext> FHECKKSRNS::EvalLinearTransformPrecompute(
             for (auto& v : vec)
                 v *= scale;
             result[ji] =
-                MakeAuxPlaintext(cc, elementParamsPtr, Rotate(vec, -step * (ji / step)), 1, towersToDrop, vec.size());
+                makeAuxPlaintext(cc, elementParamsPtr, Rotate(vec, -step * (ji / step)), 1, towersToDrop, vec.size());
         }
     }
 
@@ -1511,6 +1870,8 @@ std::vector<std::vector<ReadOnlyPlaintext>> FHECKKSRNS::EvalCoeffsToSlotsPrecomp
 
     const auto& p = GetBootPrecom(slots).m_paramsEnc;
 
+    const auto makeAuxPlaintext = GetBootPrecom(slots).m_compactPrecompute ? MakeCompactAuxPlaintext : MakeAuxPlaintext;
+
     // result is the rotated plaintext version of the coefficients
     std::vector<std::vector<ReadOnlyPlaintext>> result(p.lvlb, std::vector<ReadOnlyPlaintext>(p.numRotations));
 
@@ -1587,7 +1948,7 @@ std::vector<std::vector<ReadOnlyPlaintext>> FHECKKSRNS::EvalCoeffsToSlotsPrecomp
                     auto rot = Rotate(coeff[s][ij], ReduceRotation(-rotScale * (ij / p.g), slots));
 
                     result[s][ij] =
-                        MakeAuxPlaintext(cc, paramsVector[s - stop], rot, 1, level0 - compositeDegree * s, rot.size());
+                        makeAuxPlaintext(cc, paramsVector[s - stop], rot, 1, level0 - compositeDegree * s, rot.size());
                 }
             }
         }
@@ -1604,7 +1965,7 @@ std::vector<std::vector<ReadOnlyPlaintext>> FHECKKSRNS::EvalCoeffsToSlotsPrecomp
 
                     auto rot = Rotate(coeff[stop][ij], ReduceRotation(-p.gRem * (ij / p.gRem), slots));
 
-                    result[stop][ij] = MakeAuxPlaintext(cc, paramsVector[0], rot, 1, level0, rot.size());
+                    result[stop][ij] = makeAuxPlaintext(cc, paramsVector[0], rot, 1, level0, rot.size());
                 }
             }
         }
@@ -1638,7 +1999,7 @@ std::vector<std::vector<ReadOnlyPlaintext>> FHECKKSRNS::EvalCoeffsToSlotsPrecomp
                     auto rot = Rotate(clearTmp, ReduceRotation(-rotScale * (ij / p.g), M4));
 
                     result[s][ij] =
-                        MakeAuxPlaintext(cc, paramsVector[s - stop], rot, 1, level0 - compositeDegree * s, rot.size());
+                        makeAuxPlaintext(cc, paramsVector[s - stop], rot, 1, level0 - compositeDegree * s, rot.size());
                 }
             }
         }
@@ -1659,7 +2020,7 @@ std::vector<std::vector<ReadOnlyPlaintext>> FHECKKSRNS::EvalCoeffsToSlotsPrecomp
 
                     auto rot = Rotate(clearTmp, ReduceRotation(-p.gRem * (ij / p.gRem), M4));
 
-                    result[stop][ij] = MakeAuxPlaintext(cc, paramsVector[0], rot, 1, level0, rot.size());
+                    result[stop][ij] = makeAuxPlaintext(cc, paramsVector[0], rot, 1, level0, rot.size());
                 }
             }
         }
@@ -1674,6 +2035,8 @@ std::vector<std::vector<ReadOnlyPlaintext>> FHECKKSRNS::EvalSlotsToCoeffsPrecomp
 
     const auto& p = GetBootPrecom(slots).m_paramsDec;
 
+    const auto makeAuxPlaintext = GetBootPrecom(slots).m_compactPrecompute ? MakeCompactAuxPlaintext : MakeAuxPlaintext;
+
     const int32_t flagRem = (p.remCollapse == 0) ? 0 : 1;
 
     // result is the rotated plaintext version of coeff
@@ -1740,7 +2103,7 @@ std::vector<std::vector<ReadOnlyPlaintext>> FHECKKSRNS::EvalSlotsToCoeffsPrecomp
                     auto rot = Rotate(coeff[s][ij], ReduceRotation(-rotScale * (ij / p.g), slots));
 
                     result[s][ij] =
-                        MakeAuxPlaintext(cc, paramsVector[s], rot, 1, towersToDrop + compositeDegree * s, rot.size());
+                        makeAuxPlaintext(cc, paramsVector[s], rot, 1, towersToDrop + compositeDegree * s, rot.size());
                 }
             }
         }
@@ -1758,7 +2121,7 @@ std::vector<std::vector<ReadOnlyPlaintext>> FHECKKSRNS::EvalSlotsToCoeffsPrecomp
 
                     auto rot = Rotate(coeff[smax][ij], ReduceRotation(-rotScale * (ij / p.gRem), slots));
 
-                    result[smax][ij] = MakeAuxPlaintext(cc, paramsVector[smax], rot, 1,
+                    result[smax][ij] = makeAuxPlaintext(cc, paramsVector[smax], rot, 1,
                                                         towersToDrop + compositeDegree * smax, rot.size());
                 }
             }
@@ -1794,7 +2157,7 @@ std::vector<std::vector<ReadOnlyPlaintext>> FHECKKSRNS::EvalSlotsToCoeffsPrecomp
                     auto rot = Rotate(clearTmp, ReduceRotation(-rotScale * (ij / p.g), M4));
 
                     result[s][ij] =
-                        MakeAuxPlaintext(cc, paramsVector[s], rot, 1, towersToDrop + compositeDegree * s, rot.size());
+                        makeAuxPlaintext(cc, paramsVector[s], rot, 1, towersToDrop + compositeDegree * s, rot.size());
                 }
             }
         }
@@ -1816,7 +2179,7 @@ std::vector<std::vector<ReadOnlyPlaintext>> FHECKKSRNS::EvalSlotsToCoeffsPrecomp
 
                     auto rot = Rotate(clearTmp, ReduceRotation(-rotScale * (ij / p.gRem), M4));
 
-                    result[smax][ij] = MakeAuxPlaintext(cc, paramsVector[smax], rot, 1,
+                    result[smax][ij] = makeAuxPlaintext(cc, paramsVector[smax], rot, 1,
                                                         towersToDrop + compositeDegree * smax, rot.size());
                 }
             }
@@ -1831,59 +2194,94 @@ std::vector<std::vector<ReadOnlyPlaintext>> FHECKKSRNS::EvalSlotsToCoeffsPrecomp
 
 Ciphertext<DCRTPoly> FHECKKSRNS::EvalLinearTransform(const std::vector<ReadOnlyPlaintext>& A,
                                                      ConstCiphertext<DCRTPoly>& ct) const {
+    return EvalLinearTransformBatch(A, {ct})[0];
+}
+
+std::vector<Ciphertext<DCRTPoly>> FHECKKSRNS::EvalLinearTransformBatch(
+    const std::vector<ReadOnlyPlaintext>& A, const std::vector<ReadOnlyCiphertext<DCRTPoly>>& cts) const {
     // Computing the baby-step bStep and the giant-step gStep.
     const uint32_t slots = A.size();
     const auto& p        = GetBootPrecom(slots);
     const uint32_t bStep = (p.m_paramsEnc.g == 0) ? std::ceil(std::sqrt(slots)) : p.m_paramsEnc.g;
     const uint32_t gStep = std::ceil(static_cast<double>(slots) / bStep);
 
-    auto cc     = ct->GetCryptoContext();
-    auto digits = cc->EvalFastRotationPrecompute(ct);
+    const uint32_t numCtxts = cts.size();
+    auto cc                 = cts[0]->GetCryptoContext();
 
-    // hoisted automorphisms
-    std::vector<Ciphertext<DCRTPoly>> fastRotation(bStep - 1);
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(bStep - 1))
-    for (uint32_t j = 1; j < bStep; ++j)
-        fastRotation[j - 1] = cc->EvalFastRotationExt(ct, j, digits, true);
+    std::vector<std::shared_ptr<std::vector<DCRTPoly>>> digits(numCtxts);
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCtxts))
+    for (uint32_t c = 0; c < numCtxts; ++c)
+        digits[c] = cc->EvalFastRotationPrecompute(cts[c]);
+
+    // hoisted automorphisms; the rotations by the same index are adjacent so that each key is used for the whole batch
+    std::vector<std::vector<Ciphertext<DCRTPoly>>> fastRotation(numCtxts, std::vector<Ciphertext<DCRTPoly>>(bStep));
+    const uint32_t numRotations = numCtxts * bStep;
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numRotations))
+    for (uint32_t t = 0; t < numRotations; ++t) {
+        const uint32_t c   = t % numCtxts;
+        const uint32_t j   = t / numCtxts;
+        fastRotation[c][j] = (j == 0) ? cc->KeySwitchExt(cts[c], true) :
+                                        cc->EvalFastRotationExt(cts[c], j, digits[c], true);
+    }
 
     const uint32_t M = cc->GetCyclotomicOrder();
     const uint32_t N = cc->GetRingDimension();
     std::vector<uint32_t> map(N);
-    Ciphertext<DCRTPoly> result;
-    DCRTPoly first;
+    std::vector<Ciphertext<DCRTPoly>> result(numCtxts);
+    std::vector<DCRTPoly> first(numCtxts);
     for (uint32_t j = 0; j < gStep; ++j) {
-        auto inner = EvalMultExt(cc->KeySwitchExt(ct, true), A[bStep * j]);
-        for (uint32_t i = 1; i < bStep; ++i) {
-            if (bStep * j + i < slots)
-                EvalAddExtInPlace(inner, EvalMultExt(fastRotation[i - 1], A[bStep * j + i]));
-        }
+        // compact plaintexts are encoded one giant step at a time
+        auto Aj = EncodeAuxPlaintexts(*cc, A, bStep * j, bStep);
 
-        if (j == 0) {
-            first         = cc->KeySwitchDownFirstElement(inner);
-            auto elements = inner->GetElements();
-            elements[0].SetValuesToZero();
-            inner->SetElements(std::move(elements));
-            result = std::move(inner);
-        }
-        else {
-            inner = cc->KeySwitchDown(inner);
-            // Find the automorphism index that corresponds to rotation index index.
-            uint32_t autoIndex = FindAutomorphismIndex2nComplex(bStep * j, M);
+        // Find the automorphism index that corresponds to rotation index index.
+        uint32_t autoIndex = 0;
+        if (j > 0) {
+            autoIndex = FindAutomorphismIndex2nComplex(bStep * j, M);
             PrecomputeAutoMap(N, autoIndex, &map);
-            first += inner->GetElements()[0].AutomorphismTransform(autoIndex, map);
+        }
+
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCtxts))
+        for (uint32_t c = 0; c < numCtxts; ++c) {
+            auto inner = EvalMultExt(fastRotation[c][0], Aj[0]);
+            for (uint32_t i = 1; i < bStep; ++i) {
+                if (bStep * j + i < slots)
+                    EvalAddExtInPlace(inner, EvalMultExt(fastRotation[c][i], Aj[i]));
+            }
 
-            auto&& innerDigits = cc->EvalFastRotationPrecompute(inner);
-            EvalAddExtInPlace(result, cc->EvalFastRotationExt(inner, bStep * j, innerDigits, false));
+            if (j == 0) {
+                first[c]      = cc->KeySwitchDownFirstElement(inner);
+                auto elements = inner->GetElements();
+                elements[0].SetValuesToZero();
+                inner->SetElements(std::move(elements));
+                result[c] = std::move(inner);
+            }
+            else {
+                inner = cc->KeySwitchDown(inner);
+                first[c] += inner->GetElements()[0].AutomorphismTransform(autoIndex, map);
+
+                auto&& innerDigits = cc->EvalFastRotationPrecompute(inner);
+                EvalAddExtInPlace(result[c], cc->EvalFastRotationExt(inner, bStep * j, innerDigits, false));
+            }
         }
     }
-    result = cc->KeySwitchDown(result);
-    result->GetElements()[0] += first;
+
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCtxts))
+    for (uint32_t c = 0; c < numCtxts; ++c) {
+        result[c] = cc->KeySwitchDown(result[c]);
+        result[c]->GetElements()[0] += first[c];
+    }
     return result;
 }
 
 Ciphertext<DCRTPoly> FHECKKSRNS::EvalCoeffsToSlots(const std::vector<std::vector<ReadOnlyPlaintext>>& A,
                                                    ConstCiphertext<DCRTPoly>& ctxt) const {
-    const uint32_t slots = ctxt->GetSlots();
+    return EvalCoeffsToSlotsBatch(A, {ctxt})[0];
+}
+
+std::vector<Ciphertext<DCRTPoly>> FHECKKSRNS::EvalCoeffsToSlotsBatch(
+    const std::vector<std::vector<ReadOnlyPlaintext>>& A,
+    const std::vector<ReadOnlyCiphertext<DCRTPoly>>& ctxts) const {
+    const uint32_t slots = ctxts[0]->GetSlots();
 
     const auto& p = GetBootPrecom(slots).m_paramsEnc;
 
@@ -1901,7 +2299,7 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalCoeffsToSlots(const std::vector<std::vector
         rot_in[0].resize(p.numRotationsRem + 1);
     }
 
-    auto cc = ctxt->GetCryptoContext();
+    auto cc = ctxts[0]->GetCryptoContext();
 
     const uint32_t M4 = cc->GetCyclotomicOrder() / 4;
 
@@ -1922,7 +2320,10 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalCoeffsToSlots(const std::vector<std::vector
             rot_in[stop][j] = ReduceRotation(j - offset, slots);
     }
 
-    auto result = ctxt->Clone();
+    const uint32_t numCtxts = ctxts.size();
+    std::vector<Ciphertext<DCRTPoly>> result(numCtxts);
+    for (uint32_t c = 0; c < numCtxts; ++c)
+        result[c] = ctxts[c]->Clone();
 
     uint32_t N = cc->GetRingDimension();
     std::vector<uint32_t> map(N);
@@ -1931,116 +2332,104 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalCoeffsToSlots(const std::vector<std::vector
     const auto cryptoParams  = std::dynamic_pointer_cast<CryptoParametersCKKSRNS>(cc->GetCryptoParameters());
     uint32_t compositeDegree = cryptoParams->GetCompositeDegree();
 
+    std::vector<std::shared_ptr<std::vector<DCRTPoly>>> digits(numCtxts);
+    std::vector<Ciphertext<DCRTPoly>> outer(numCtxts);
+    std::vector<DCRTPoly> first(numCtxts);
+
     // hoisted automorphisms
     const int32_t smax = -1 + p.lvlb;
-    for (int32_t s = smax; s > stop; --s) {
-        if (s != smax)
-            algo->ModReduceInternalInPlace(result, compositeDegree);
+    for (int32_t s = smax; s >= 0; --s) {
+        // the remainder level (if any) is the last one processed
+        const bool isRem   = (s == stop);
+        const uint32_t g   = isRem ? p.gRem : p.g;
+        const uint32_t b   = isRem ? p.bRem : p.b;
+        const uint32_t nr  = isRem ? p.numRotationsRem : p.numRotations;
+        const bool reduce  = isRem || (s != smax);
+        const auto& As     = A[s];
+        const auto& rotIn  = rot_in[s];
+        const auto& rotOut = rot_out[s];
 
         // computes the NTTs for each CRT limb (for the hoisted automorphisms used later on)
-        auto digits = cc->EvalFastRotationPrecompute(result);
-        std::vector<Ciphertext<DCRTPoly>> fastRotation(p.g);
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(p.g))
-        for (uint32_t j = 0; j < p.g; ++j)
-            fastRotation[j] = (rot_in[s][j] != 0) ? cc->EvalFastRotationExt(result, rot_in[s][j], digits, true) :
-                                                    cc->KeySwitchExt(result, true);
-
-        Ciphertext<DCRTPoly> outer;
-        DCRTPoly first;
-        for (uint32_t i = 0; i < p.b; ++i) {
-            // for the first iteration with j=0:
-            uint32_t G = p.g * i;
-            auto inner = EvalMultExt(fastRotation[0], A[s][G]);
-            // continue the loop
-            for (uint32_t j = 1; j < p.g; ++j) {
-                if ((G + j) != p.numRotations)
-                    EvalAddExtInPlace(inner, EvalMultExt(fastRotation[j], A[s][G + j]));
-            }
-
-            if (i == 0) {
-                first = cc->KeySwitchDownFirstElement(inner);
-                outer = std::move(inner);
-                outer->GetElements()[0].SetValuesToZero();
-            }
-            else {
-                if (rot_out[s][i] != 0) {
-                    inner = cc->KeySwitchDown(inner);
-                    // Find the automorphism index that corresponds to rotation index index.
-                    uint32_t autoIndex = FindAutomorphismIndex2nComplex(rot_out[s][i], cc->GetCyclotomicOrder());
-                    PrecomputeAutoMap(N, autoIndex, &map);
-                    first += inner->GetElements()[0].AutomorphismTransform(autoIndex, map);
-                    auto&& innerDigits = cc->EvalFastRotationPrecompute(inner);
-                    EvalAddExtInPlace(outer, cc->EvalFastRotationExt(inner, rot_out[s][i], innerDigits, false));
-                }
-                else {
-                    first += cc->KeySwitchDownFirstElement(inner);
-                    auto& elements = inner->GetElements();
-                    elements[0].SetValuesToZero();
-                    EvalAddExtInPlace(outer, inner);
-                }
-            }
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCtxts))
+        for (uint32_t c = 0; c < numCtxts; ++c) {
+            if (reduce)
+                algo->ModReduceInternalInPlace(result[c], compositeDegree);
+            digits[c] = cc->EvalFastRotationPrecompute(result[c]);
         }
-        result = cc->KeySwitchDown(outer);
-        result->GetElements()[0] += first;
-    }
 
-    if (flagRem == 1) {
-        algo->ModReduceInternalInPlace(result, compositeDegree);
-
-        // computes the NTTs for each CRT limb (for the hoisted automorphisms used later on)
-        auto digits = cc->EvalFastRotationPrecompute(result);
-        std::vector<Ciphertext<DCRTPoly>> fastRotationRem(p.gRem);
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(p.gRem))
-        for (uint32_t j = 0; j < p.gRem; ++j)
-            fastRotationRem[j] = (rot_in[stop][j] != 0) ?
-                                     cc->EvalFastRotationExt(result, rot_in[stop][j], digits, true) :
-                                     cc->KeySwitchExt(result, true);
+        // the rotations by the same index are adjacent so that each key is used for the whole batch
+        std::vector<std::vector<Ciphertext<DCRTPoly>>> fastRotation(numCtxts, std::vector<Ciphertext<DCRTPoly>>(g));
+        const uint32_t numRotations = numCtxts * g;
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numRotations))
+        for (uint32_t t = 0; t < numRotations; ++t) {
+            const uint32_t c   = t % numCtxts;
+            const uint32_t j   = t / numCtxts;
+            fastRotation[c][j] = (rotIn[j] != 0) ? cc->EvalFastRotationExt(result[c], rotIn[j], digits[c], true) :
+                                                   cc->KeySwitchExt(result[c], true);
+        }
 
-        Ciphertext<DCRTPoly> outer;
-        DCRTPoly first;
-        for (uint32_t i = 0; i < p.bRem; ++i) {
+        for (uint32_t i = 0; i < b; ++i) {
             // for the first iteration with j=0:
-            int32_t GRem = p.gRem * i;
-            auto inner   = EvalMultExt(fastRotationRem[0], A[stop][GRem]);
-            // continue the loop
-            for (uint32_t j = 1; j < p.gRem; ++j) {
-                if ((GRem + j) != p.numRotationsRem)
-                    EvalAddExtInPlace(inner, EvalMultExt(fastRotationRem[j], A[stop][GRem + j]));
-            }
+            uint32_t G = g * i;
+            // compact plaintexts are encoded one giant step at a time
+            auto AG = EncodeAuxPlaintexts(*cc, As, G, g);
 
-            if (i == 0) {
-                first = cc->KeySwitchDownFirstElement(inner);
-                outer = std::move(inner);
-                outer->GetElements()[0].SetValuesToZero();
+            // Find the automorphism index that corresponds to rotation index index.
+            uint32_t autoIndex = 0;
+            if (i != 0 && rotOut[i] != 0) {
+                autoIndex = FindAutomorphismIndex2nComplex(rotOut[i], cc->GetCyclotomicOrder());
+                PrecomputeAutoMap(N, autoIndex, &map);
             }
-            else {
-                if (rot_out[stop][i] != 0) {
-                    inner = cc->KeySwitchDown(inner);
-                    // Find the automorphism index that corresponds to rotation index index.
-                    uint32_t autoIndex = FindAutomorphismIndex2nComplex(rot_out[stop][i], cc->GetCyclotomicOrder());
-                    PrecomputeAutoMap(N, autoIndex, &map);
-                    first += inner->GetElements()[0].AutomorphismTransform(autoIndex, map);
-                    auto&& innerDigits = cc->EvalFastRotationPrecompute(inner);
-                    EvalAddExtInPlace(outer, cc->EvalFastRotationExt(inner, rot_out[stop][i], innerDigits, false));
+
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCtxts))
+            for (uint32_t c = 0; c < numCtxts; ++c) {
+                auto inner = EvalMultExt(fastRotation[c][0], AG[0]);
+                // continue the loop
+                for (uint32_t j = 1; j < g; ++j) {
+                    if ((G + j) != nr)
+                        EvalAddExtInPlace(inner, EvalMultExt(fastRotation[c][j], AG[j]));
+                }
+
+                if (i == 0) {
+                    first[c] = cc->KeySwitchDownFirstElement(inner);
+                    outer[c] = std::move(inner);
+                    outer[c]->GetElements()[0].SetValuesToZero();
                 }
                 else {
-                    first += cc->KeySwitchDownFirstElement(inner);
-                    auto elements = inner->GetElements();
-                    elements[0].SetValuesToZero();
-                    inner->SetElements(std::move(elements));
-                    EvalAddExtInPlace(outer, inner);
+                    if (rotOut[i] != 0) {
+                        inner = cc->KeySwitchDown(inner);
+                        first[c] += inner->GetElements()[0].AutomorphismTransform(autoIndex, map);
+                        auto&& innerDigits = cc->EvalFastRotationPrecompute(inner);
+                        EvalAddExtInPlace(outer[c], cc->EvalFastRotationExt(inner, rotOut[i], innerDigits, false));
+                    }
+                    else {
+                        first[c] += cc->KeySwitchDownFirstElement(inner);
+                        auto& elements = inner->GetElements();
+                        elements[0].SetValuesToZero();
+                        EvalAddExtInPlace(outer[c], inner);
+                    }
                 }
             }
         }
-        result = cc->KeySwitchDown(outer);
-        result->GetElements()[0] += first;
+
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCtxts))
+        for (uint32_t c = 0; c < numCtxts; ++c) {
+            result[c] = cc->KeySwitchDown(outer[c]);
+            result[c]->GetElements()[0] += first[c];
+        }
     }
     return result;
 }
 
 Ciphertext<DCRTPoly> FHECKKSRNS::EvalSlotsToCoeffs(const std::vector<std::vector<ReadOnlyPlaintext>>& A,
                                                    ConstCiphertext<DCRTPoly>& ctxt) const {
-    const uint32_t slots = ctxt->GetSlots();
+    return EvalSlotsToCoeffsBatch(A, {ctxt})[0];
+}
+
+std::vector<Ciphertext<DCRTPoly>> FHECKKSRNS::EvalSlotsToCoeffsBatch(
+    const std::vector<std::vector<ReadOnlyPlaintext>>& A,
+    const std::vector<ReadOnlyCiphertext<DCRTPoly>>& ctxts) const {
+    const uint32_t slots = ctxts[0]->GetSlots();
 
     const auto& p = GetBootPrecom(slots).m_paramsDec;
 
@@ -2053,7 +2442,7 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalSlotsToCoeffs(const std::vector<std::vector
         rot_in[p.lvlb - 1].resize(p.numRotationsRem + 1);
     }
 
-    auto cc = ctxt->GetCryptoContext();
+    auto cc = ctxts[0]->GetCryptoContext();
 
     const uint32_t M4    = cc->GetCyclotomicOrder() / 4;
     const int32_t smax   = p.lvlb - flagRem;
@@ -2076,7 +2465,10 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalSlotsToCoeffs(const std::vector<std::vector
     }
 
     //  No need for Encrypted Bit Reverse
-    auto result = ctxt->Clone();
+    const uint32_t numCtxts = ctxts.size();
+    std::vector<Ciphertext<DCRTPoly>> result(numCtxts);
+    for (uint32_t c = 0; c < numCtxts; ++c)
+        result[c] = ctxts[c]->Clone();
 
     uint32_t N = cc->GetRingDimension();
     std::vector<uint32_t> map(N);
@@ -2085,113 +2477,93 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalSlotsToCoeffs(const std::vector<std::vector
     const auto cryptoParams  = std::dynamic_pointer_cast<CryptoParametersCKKSRNS>(cc->GetCryptoParameters());
     uint32_t compositeDegree = cryptoParams->GetCompositeDegree();
 
+    std::vector<std::shared_ptr<std::vector<DCRTPoly>>> digits(numCtxts);
+    std::vector<Ciphertext<DCRTPoly>> outer(numCtxts);
+    std::vector<DCRTPoly> first(numCtxts);
+
     // hoisted automorphisms
-    for (int32_t s = 0; s < smax; ++s) {
-        if (s != 0)
-            algo->ModReduceInternalInPlace(result, compositeDegree);
+    for (int32_t s = 0; s < static_cast<int32_t>(p.lvlb); ++s) {
+        // the remainder level (if any) is the last one processed
+        const bool isRem   = (s == smax);
+        const uint32_t g   = isRem ? p.gRem : p.g;
+        const uint32_t b   = isRem ? p.bRem : p.b;
+        const uint32_t nr  = isRem ? p.numRotationsRem : p.numRotations;
+        const bool reduce  = isRem || (s != 0);
+        const auto& As     = A[s];
+        const auto& rotIn  = rot_in[s];
+        const auto& rotOut = rot_out[s];
 
         // computes the NTTs for each CRT limb (for the hoisted automorphisms used later on)
-        auto digits = cc->EvalFastRotationPrecompute(result);
-        std::vector<Ciphertext<DCRTPoly>> fastRotation(p.g);
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(p.g))
-        for (uint32_t j = 0; j < p.g; ++j)
-            fastRotation[j] = (rot_in[s][j] != 0) ? cc->EvalFastRotationExt(result, rot_in[s][j], digits, true) :
-                                                    cc->KeySwitchExt(result, true);
-
-        Ciphertext<DCRTPoly> outer;
-        DCRTPoly first;
-        for (uint32_t i = 0; i < p.b; ++i) {
-            // for the first iteration with j=0:
-            uint32_t G = i * p.g;
-            auto inner = EvalMultExt(fastRotation[0], A[s][G]);
-            // continue the loop
-            for (uint32_t j = 1; j < p.g; ++j) {
-                if ((G + j) != p.numRotations)
-                    EvalAddExtInPlace(inner, EvalMultExt(fastRotation[j], A[s][G + j]));
-            }
-
-            if (i == 0) {
-                first         = cc->KeySwitchDownFirstElement(inner);
-                auto elements = inner->GetElements();
-                elements[0].SetValuesToZero();
-                inner->SetElements(std::move(elements));
-                outer = std::move(inner);
-            }
-            else {
-                if (rot_out[s][i] != 0) {
-                    inner = cc->KeySwitchDown(inner);
-                    // Find the automorphism index that corresponds to rotation index index.
-                    auto autoIndex = FindAutomorphismIndex2nComplex(rot_out[s][i], cc->GetCyclotomicOrder());
-                    PrecomputeAutoMap(N, autoIndex, &map);
-                    first += inner->GetElements()[0].AutomorphismTransform(autoIndex, map);
-                    auto&& innerDigits = cc->EvalFastRotationPrecompute(inner);
-                    EvalAddExtInPlace(outer, cc->EvalFastRotationExt(inner, rot_out[s][i], innerDigits, false));
-                }
-                else {
-                    first += cc->KeySwitchDownFirstElement(inner);
-                    auto elements = inner->GetElements();
-                    elements[0].SetValuesToZero();
-                    inner->SetElements(std::move(elements));
-                    EvalAddExtInPlace(outer, inner);
-                }
-            }
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCtxts))
+        for (uint32_t c = 0; c < numCtxts; ++c) {
+            if (reduce)
+                algo->ModReduceInternalInPlace(result[c], compositeDegree);
+            digits[c] = cc->EvalFastRotationPrecompute(result[c]);
         }
-        result = cc->KeySwitchDown(outer);
-        result->GetElements()[0] += first;
-    }
 
-    if (flagRem == 1) {
-        algo->ModReduceInternalInPlace(result, compositeDegree);
-
-        // computes the NTTs for each CRT limb (for the hoisted automorphisms used later on)
-        auto digits = cc->EvalFastRotationPrecompute(result);
-        std::vector<Ciphertext<DCRTPoly>> fastRotationRem(p.gRem);
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(p.gRem))
-        for (uint32_t j = 0; j < p.gRem; ++j)
-            fastRotationRem[j] = (rot_in[smax][j] != 0) ?
-                                     cc->EvalFastRotationExt(result, rot_in[smax][j], digits, true) :
-                                     cc->KeySwitchExt(result, true);
+        // the rotations by the same index are adjacent so that each key is used for the whole batch
+        std::vector<std::vector<Ciphertext<DCRTPoly>>> fastRotation(numCtxts, std::vector<Ciphertext<DCRTPoly>>(g));
+        const uint32_t numRotations = numCtxts * g;
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numRotations))
+        for (uint32_t t = 0; t < numRotations; ++t) {
+            const uint32_t c   = t % numCtxts;
+            const uint32_t j   = t / numCtxts;
+            fastRotation[c][j] = (rotIn[j] != 0) ? cc->EvalFastRotationExt(result[c], rotIn[j], digits[c], true) :
+                                                   cc->KeySwitchExt(result[c], true);
+        }
 
-        Ciphertext<DCRTPoly> outer;
-        DCRTPoly first;
-        for (uint32_t i = 0; i < p.bRem; ++i) {
+        for (uint32_t i = 0; i < b; ++i) {
             // for the first iteration with j=0:
-            uint32_t GRem = i * p.gRem;
-            auto inner    = EvalMultExt(fastRotationRem[0], A[smax][GRem]);
-            // continue the loop
-            for (uint32_t j = 1; j < p.gRem; ++j) {
-                if ((GRem + j) != p.numRotationsRem)
-                    EvalAddExtInPlace(inner, EvalMultExt(fastRotationRem[j], A[smax][GRem + j]));
-            }
+            uint32_t G = i * g;
+            // compact plaintexts are encoded one giant step at a time
+            auto AG = EncodeAuxPlaintexts(*cc, As, G, g);
 
-            if (i == 0) {
-                first         = cc->KeySwitchDownFirstElement(inner);
-                auto elements = inner->GetElements();
-                elements[0].SetValuesToZero();
-                inner->SetElements(std::move(elements));
-                outer = std::move(inner);
+            // Find the automorphism index that corresponds to rotation index index.
+            uint32_t autoIndex = 0;
+            if (i != 0 && rotOut[i] != 0) {
+                autoIndex = FindAutomorphismIndex2nComplex(rotOut[i], cc->GetCyclotomicOrder());
+                PrecomputeAutoMap(N, autoIndex, &map);
             }
-            else {
-                if (rot_out[smax][i] != 0) {
-                    inner = cc->KeySwitchDown(inner);
-                    // Find the automorphism index that corresponds to rotation index index.
-                    auto autoIndex = FindAutomorphismIndex2nComplex(rot_out[smax][i], cc->GetCyclotomicOrder());
-                    PrecomputeAutoMap(N, autoIndex, &map);
-                    first += inner->GetElements()[0].AutomorphismTransform(autoIndex, map);
-                    auto innerDigits = cc->EvalFastRotationPrecompute(inner);
-                    EvalAddExtInPlace(outer, cc->EvalFastRotationExt(inner, rot_out[smax][i], innerDigits, false));
+
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCtxts))
+            for (uint32_t c = 0; c < numCtxts; ++c) {
+                auto inner = EvalMultExt(fastRotation[c][0], AG[0]);
+                // continue the loop
+                for (uint32_t j = 1; j < g; ++j) {
+                    if ((G + j) != nr)
+                        EvalAddExtInPlace(inner, EvalMultExt(fastRotation[c][j], AG[j]));
                 }
-                else {
-                    first += cc->KeySwitchDownFirstElement(inner);
+
+                if (i == 0) {
+                    first[c]      = cc->KeySwitchDownFirstElement(inner);
                     auto elements = inner->GetElements();
                     elements[0].SetValuesToZero();
                     inner->SetElements(std::move(elements));
-                    EvalAddExtInPlace(outer, inner);
+                    outer[c] = std::move(inner);
+                }
+                else {
+                    if (rotOut[i] != 0) {
+                        inner = cc->KeySwitchDown(inner);
+                        first[c] += inner->GetElements()[0].AutomorphismTransform(autoIndex, map);
+                        auto&& innerDigits = cc->EvalFastRotationPrecompute(inner);
+                        EvalAddExtInPlace(outer[c], cc->EvalFastRotationExt(inner, rotOut[i], innerDigits, false));
+                    }
+                    else {
+                        first[c] += cc->KeySwitchDownFirstElement(inner);
+                        auto elements = inner->GetElements();
+                        elements[0].SetValuesToZero();
+                        inner->SetElements(std::move(elements));
+                        EvalAddExtInPlace(outer[c], inner);
+                    }
                 }
             }
         }
-        result = cc->KeySwitchDown(outer);
-        result->GetElements()[0] += first;
+
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCtxts))
+        for (uint32_t c = 0; c < numCtxts; ++c) {
+            result[c] = cc->KeySwitchDown(outer[c]);
+            result[c]->GetElements()[0] += first[c];
+        }
     }
     return result;
 }
@@ -2364,6 +2736,8 @@ void FHECKKSRNS::ExtendCiphertext(std::vector<DCRTPoly>& ctxtDCRTs, const Crypto
 }
 
 void FHECKKSRNS::ApplyDoubleAngleIterations(Ciphertext<DCRTPoly>& ciphertext, uint32_t numIter) const {
+    PerfScope perfScope(PerfOp::BOOT_DOUBLE_ANGLE);
+
     constexpr double twoPi = 2.0 * M_PI;
 
     auto cc = ciphertext->GetCryptoContext();
@@ -2720,6 +3094,47 @@ Plaintext FHECKKSRNS::MakeAuxPlaintext(const CryptoContextImpl<DCRTPoly>& cc, co
 }
 #endif
 
+Plaintext FHECKKSRNS::MakeCompactAuxPlaintext(const CryptoContextImpl<DCRTPoly>& cc,
+                                              const std::shared_ptr<ParmType> params,
+                                              const std::vector<std::complex<double>>& value, size_t noiseScaleDeg,
+                                              uint32_t level, uint32_t slots) {
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSRNS>(cc.GetCryptoParameters());
+
+    // only the slot values are stored; the element keeps the parameters and stays in COEFFICIENT format without
+    // any data until the plaintext is encoded by EncodeAuxPlaintexts
+    return Plaintext(std::make_shared<CKKSPackedEncoding>(params, cc.GetEncodingParams(), value, noiseScaleDeg, level,
+                                                          cryptoParams->GetScalingFactorReal(level), slots, COMPLEX));
+}
+
+std::vector<ReadOnlyPlaintext> FHECKKSRNS::EncodeAuxPlaintexts(const CryptoContextImpl<DCRTPoly>& cc,
+                                                               const std::vector<ReadOnlyPlaintext>& A, uint32_t start,
+                                                               uint32_t count) {
+    // plaintexts produced by MakeAuxPlaintext are always in EVALUATION format
+    auto isCompact = [](const ReadOnlyPlaintext& pt) {
+        return pt != nullptr && pt->GetElement<DCRTPoly>().GetFormat() == Format::COEFFICIENT;
+    };
+
+    std::vector<ReadOnlyPlaintext> result(count);
+    const uint32_t end  = std::min<uint32_t>(start + count, A.size());
+    uint32_t numCompact = 0;
+    for (uint32_t i = start; i < end; ++i) {
+        result[i - start] = A[i];
+        numCompact += isCompact(A[i]);
+    }
+    if (numCompact == 0)
+        return result;
+
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCompact))
+    for (uint32_t i = 0; i < count; ++i) {
+        if (isCompact(result[i])) {
+            const auto& pt = result[i];
+            result[i]      = MakeAuxPlaintext(cc, pt->GetElement<DCRTPoly>().GetParams(), pt->GetCKKSPackedValue(),
+                                              pt->GetNoiseScaleDeg(), pt->GetLevel(), pt->GetSlots());
+        }
+    }
+    return result;
+}
+
 Ciphertext<DCRTPoly> FHECKKSRNS::EvalMultExt(ConstCiphertext<DCRTPoly> ciphertext, ConstPlaintext plaintext) {
     auto pt = plaintext->GetElement<DCRTPoly>();
     pt.SetFormat(Format::EVALUATION);
@@ -3618,6 +4033,8 @@ EvalKey<DCRTPoly> FHECKKSRNS::KeySwitchGenSparse(const PrivateKey<DCRTPoly>& old
 }
 
 Ciphertext<DCRTPoly> FHECKKSRNS::KeySwitchSparse(Ciphertext<DCRTPoly>& ciphertext, const EvalKey<DCRTPoly>& ek) {
+    PerfScope perfScope(PerfOp::KEY_SWITCH);
+
     auto paramsqp = ek->GetAVector()[0].GetParams();
     auto modulusq = paramsqp->GetParams()[0]->GetModulus();
     auto rootq    = paramsqp->GetParams()[0]->GetRootOfUnity();
@@ -63,13 +63,7 @@ DecryptResult MultipartyCKKSRNS::MultipartyDecryptFusion(const std::vector<Ciphe
                                                          Poly* plaintext) const {
     const auto cryptoParams =
         std::dynamic_pointer_cast<CryptoParametersCKKSRNS>(ciphertextVec[0]->GetCryptoParameters());
-    const std::vector<DCRTPoly>& cv0 = ciphertextVec[0]->GetElements();
-
-    DCRTPoly b = cv0[0];
-    for (size_t i = 1; i < ciphertextVec.size(); i++) {
-        const std::vector<DCRTPoly>& cvi = ciphertextVec[i]->GetElements();
-        b += cvi[0];
-    }
+    DCRTPoly b = SumPartialDecryptions(ciphertextVec);
     b.SetFormat(Format::COEFFICIENT);
 
     *plaintext = b.CRTInterpolate();
@@ -92,13 +86,7 @@ DecryptResult MultipartyCKKSRNS::MultipartyDecryptFusion(const std::vector<Ciphe
     const auto cryptoParams =
         std::dynamic_pointer_cast<CryptoParametersCKKSRNS>(ciphertextVec[0]->GetCryptoParameters());
 
-    const std::vector<DCRTPoly>& cv0 = ciphertextVec[0]->GetElements();
-
-    DCRTPoly b = cv0[0];
-    for (size_t i = 1; i < ciphertextVec.size(); i++) {
-        const std::vector<DCRTPoly>& cvi = ciphertextVec[i]->GetElements();
-        b += cvi[0];
-    }
+    DCRTPoly b = SumPartialDecryptions(ciphertextVec);
     b.SetFormat(Format::COEFFICIENT);
 
     //  const size_t sizeQl = b.GetParams()->GetParams().size();
@@ -163,10 +163,8 @@ namespace lbcrypto {
 // Key and modulus switch and extraction methods
 //------------------------------------------------------------------------------
 
-static NativeInteger RoundqQAlter(NativeInteger v, NativeInteger q, NativeInteger Q) {
-    return NativeInteger(static_cast<BasicInteger>(
-                             std::floor(0.5 + v.ConvertToDouble() * q.ConvertToDouble() / Q.ConvertToDouble())))
-        .Mod(q);
+static NativeInteger RoundqQAlter(const NativeInteger& v, const NativeInteger& q, double qDouble, double QDouble) {
+    return NativeInteger(static_cast<BasicInteger>(std::floor(0.5 + v.ConvertToDouble() * qDouble / QDouble))).Mod(q);
 }
 
 // TODO: used anywhere?
@@ -303,28 +301,38 @@ EvalKey<DCRTPoly> switchingKeyGenRLWEcc(const PrivateKey<DCRTPoly>& ckksSKto, co
     return ccCKKSto->KeySwitchGen(oldTranformedSK, RLWELWEsk);
 }
 
-std::vector<std::vector<NativeInteger>> ExtractLWEpacked(const Ciphertext<DCRTPoly>& ct) {
+// Extracts the LWE ciphertexts encrypting the coefficients 0, gap, 2 * gap, ... of the RLWE ciphertext ct and
+// switches them from modulusFrom to modulusTo in the same pass, without materializing the intermediate ciphertexts.
+static std::vector<std::shared_ptr<LWECiphertextImpl>> ExtractLWECiphertexts(const Ciphertext<DCRTPoly>& ct,
+                                                                             const NativeInteger& modulusFrom,
+                                                                             const NativeInteger& modulusTo, uint32_t n,
+                                                                             uint32_t numCtxts, uint32_t gap) {
     auto originalA{(ct->GetElements()[1]).GetElementAtIndex(0)};
     originalA.SetFormat(Format::COEFFICIENT);
-    auto* ptrA = &originalA.GetValues()[0];
     auto originalB{(ct->GetElements()[0]).GetElementAtIndex(0)};
     originalB.SetFormat(Format::COEFFICIENT);
-    auto* ptrB = &originalB.GetValues()[0];
-    size_t N   = originalB.GetLength();
-    return {std::vector<NativeInteger>(ptrB, ptrB + N), std::vector<NativeInteger>(ptrA, ptrA + N)};
-}
+    const auto& valuesA = originalA.GetValues();
+    const auto& valuesB = originalB.GetValues();
+    const uint32_t N    = valuesA.GetLength();
+
+    const bool modSwitch = (modulusTo != modulusFrom);
+    const double qDouble = modulusTo.ConvertToDouble();
+    const double QDouble = modulusFrom.ConvertToDouble();
 
-std::shared_ptr<LWECiphertextImpl> ExtractLWECiphertext(const std::vector<std::vector<NativeInteger>>& aANDb,
-                                                        NativeInteger modulus, uint32_t n, uint32_t index = 0) {
-    NativeVector a(n, modulus);
-    for (uint32_t i = 0; i < n && i <= index; ++i)
-        a[i] = modulus - aANDb[1][index - i];
-    if (n > index) {
-        uint32_t N = aANDb[0].size();
-        for (uint32_t i = index + 1; i < n; ++i)
-            a[i] = aANDb[1][N + index - i];
-    }
-    return std::make_shared<LWECiphertextImpl>(std::move(a), aANDb[0][index]);
+    std::vector<std::shared_ptr<LWECiphertextImpl>> LWEciphertexts(numCtxts);
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCtxts))
+    for (uint32_t i = 0; i < numCtxts; ++i) {
+        const uint32_t idx = i * gap;
+        NativeVector a(n, modulusTo);
+        for (uint32_t j = 0; j < n; ++j) {
+            // a[j] = -A[idx - j] for j <= idx, and A[N + idx - j] after the negacyclic wrap-around
+            NativeInteger aj = (j <= idx) ? modulusFrom.ModSub(valuesA[idx - j], modulusFrom) : valuesA[N + idx - j];
+            a[j]             = modSwitch ? RoundqQAlter(aj, modulusTo, qDouble, QDouble) : aj;
+        }
+        NativeInteger b   = modSwitch ? RoundqQAlter(valuesB[idx], modulusTo, qDouble, QDouble) : valuesB[idx];
+        LWEciphertexts[i] = std::make_shared<LWECiphertextImpl>(std::move(a), std::move(b));
+    }
+    return LWEciphertexts;
 }
 
 //------------------------------------------------------------------------------
@@ -608,24 +616,30 @@ Ciphertext<DCRTPoly> SWITCHCKKSRNS::EvalLTRectWithPrecomputeSwitch(
     for (uint32_t j = 1; j < bStep; ++j)
         fastRotation[j - 1] = cc.EvalFastRotationExt(ct, j, digits, true);
 
+    auto ctExt = cc.KeySwitchExt(ct, true);
+
     std::vector<uint32_t> map(N);
     Ciphertext<DCRTPoly> result;
     DCRTPoly first;
 
+    std::vector<Ciphertext<DCRTPoly>> products(bStep);
     for (uint32_t j = 0; j < gStep; j++) {
         int32_t offset = (j == 0) ? 0 : -static_cast<int32_t>(bStep * j);
-        auto temp      = cc.MakeCKKSPackedPlaintext(Rotate(Fill(A[bStep * j], N / 2), offset), 1, towersToDrop,
-                                                    elementParamsPtr2, N / 2);
-        auto inner     = FHECKKSRNS::EvalMultExt(cc.KeySwitchExt(ct, true), temp);
-
-        for (uint32_t i = 1; i < bStep; i++) {
-            if (bStep * j + i < n) {
-                auto tempi = cc.MakeCKKSPackedPlaintext(Rotate(Fill(A[bStep * j + i], N / 2), offset), 1, towersToDrop,
-                                                        elementParamsPtr2, N / 2);
-                FHECKKSRNS::EvalAddExtInPlace(inner, FHECKKSRNS::EvalMultExt(fastRotation[i - 1], tempi));
-            }
+
+        // Encoding the diagonals dominates the cost, so the diagonals of one giant step are encoded and multiplied
+        // in parallel; only bStep plaintexts are alive at a time
+        uint32_t numDiags = std::min(bStep, n - bStep * j);
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numDiags))
+        for (uint32_t i = 0; i < numDiags; i++) {
+            auto tempi  = cc.MakeCKKSPackedPlaintext(Rotate(Fill(A[bStep * j + i], N / 2), offset), 1, towersToDrop,
+                                                     elementParamsPtr2, N / 2);
+            products[i] = FHECKKSRNS::EvalMultExt((i == 0) ? ctExt : fastRotation[i - 1], tempi);
         }
 
+        auto inner = std::move(products[0]);
+        for (uint32_t i = 1; i < numDiags; i++)
+            FHECKKSRNS::EvalAddExtInPlace(inner, products[i]);
+
         if (j == 0) {
             first         = cc.KeySwitchDownFirstElement(inner);
             auto elements = inner->GetElements();
@@ -709,17 +723,18 @@ Ciphertext<DCRTPoly> SWITCHCKKSRNS::EvalPartialHomDecryption(const CryptoContext
                                                              ConstCiphertext<DCRTPoly> ct, uint32_t dim1, double scale,
                                                              uint32_t L) const {
     // Currently, by design, the # rows (# LWE ciphertexts to switch) is a power of two.
-    // Ensure that # cols (LWE lattice parameter n) is padded up to a power of two
-    auto Acopy      = A;
+    // Ensure that # cols (LWE lattice parameter n) is padded up to a power of two; the copy is only made if needed
     size_t cols_po2 = 1 << static_cast<uint32_t>(std::ceil(std::log2(A[0].size())));
     if (cols_po2 > A[0].size()) {
+        auto Acopy = A;
         for (size_t i = 0; i < A.size(); ++i)
             Acopy[i].resize(cols_po2);
+        return EvalPartialHomDecryption(cc, Acopy, ct, dim1, scale, L);
     }
 
-    auto Apre = EvalLTRectPrecomputeSwitch(Acopy, dim1, scale);
-    // The result is repeated every Acopy.size() slots
-    return EvalLTRectWithPrecomputeSwitch(cc, Apre, ct, (Acopy.size() < A[0].size()), dim1, L);
+    auto Apre = EvalLTRectPrecomputeSwitch(A, dim1, scale);
+    // The result is repeated every A.size() slots
+    return EvalLTRectWithPrecomputeSwitch(cc, Apre, ct, (A.size() < A[0].size()), dim1, L);
 }
 
 //------------------------------------------------------------------------------
@@ -904,33 +919,10 @@ std::vector<std::shared_ptr<LWECiphertextImpl>> SWITCHCKKSRNS::EvalCKKStoFHEW(Co
     auto ccKS       = ctxtKS->GetCryptoContext();  // Use this instead of m_ccKS to work with serialization
     auto ctSwitched = ccKS->KeySwitch(ctxtKS, m_CKKStoFHEWswk);
 
-    // Step 4. Extract LWE ciphertexts with the modulus Q'
-    uint32_t n = m_ccLWE->GetParams()->GetLWEParams()->Getn();  // lattice parameter for additive LWE
-    std::vector<std::shared_ptr<LWECiphertextImpl>> LWEciphertexts(numCtxts);
-    auto AandB = ExtractLWEpacked(ctSwitched);
-
+    // Step 4. Extract LWE ciphertexts with the modulus Q' and modulus switch them to q in FHEW
+    uint32_t n   = m_ccLWE->GetParams()->GetLWEParams()->Getn();  // lattice parameter for additive LWE
     uint32_t gap = ccKS->GetRingDimension() / (2 * m_numSlotsCKKS);
-    for (uint32_t i = 0, idx = 0; i < numCtxts; ++i, idx += gap)
-        LWEciphertexts[i] = ExtractLWECiphertext(AandB, m_modulus_CKKS_from, n, idx);
-
-    // Step 5. Modulus switch to q in FHEW
-
-    // Compute the necessary factor to obtaine the message Q'/pLWE
-    if (m_modulus_LWE != m_modulus_CKKS_from) {
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numCtxts))
-        for (uint32_t i = 0; i < numCtxts; ++i) {
-            auto& original_a = LWEciphertexts[i]->GetA();
-            auto original_b = LWEciphertexts[i]->GetB();
-            // multiply by Q_LWE/Q' and round to Q_LWE
-            NativeVector a_round(n, m_modulus_LWE);
-            for (uint32_t j = 0; j < n; ++j)
-                a_round[j] = RoundqQAlter(original_a[j], m_modulus_LWE, m_modulus_CKKS_from);
-            NativeInteger b_round = RoundqQAlter(original_b, m_modulus_LWE, m_modulus_CKKS_from);
-            LWEciphertexts[i]     = std::make_shared<LWECiphertextImpl>(std::move(a_round), std::move(b_round));
-        }
-    }
-
-    return LWEciphertexts;
+    return ExtractLWECiphertexts(ctSwitched, m_modulus_CKKS_from, m_modulus_LWE, n, numCtxts, gap);
 }
 
 //------------------------------------------------------------------------------
@@ -1046,6 +1038,8 @@ Ciphertext<DCRTPoly> SWITCHCKKSRNS::EvalFHEWtoCKKS(std::vector<std::shared_ptr<L
     numValues = std::min(numValues, slots);  // This is the number of LWE ciphertexts to pack into the CKKS ciphertext
 
     uint32_t n = LWECiphertexts[0]->GetA().GetLength();
+    // The homomorphic decryption needs the columns of A padded up to a power of two
+    const uint32_t n_po2 = 1 << static_cast<uint32_t>(std::ceil(std::log2(n)));
 
     auto ccCKKS                 = m_FHEWtoCKKSswk->GetCryptoContext();
     const auto cryptoParamsCKKS = std::dynamic_pointer_cast<CryptoParametersCKKSRNS>(ccCKKS->GetCryptoParameters());
@@ -1085,7 +1079,7 @@ Ciphertext<DCRTPoly> SWITCHCKKSRNS::EvalFHEWtoCKKS(std::vector<std::shared_ptr<L
 #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numValues))
     for (uint32_t i = 0; i < numValues; ++i) {
         auto& a = LWECiphertexts[i]->GetA();
-        A[i].resize(a.GetLength());
+        A[i].resize(n_po2);
         for (uint32_t j = 0; j < a.GetLength(); ++j)
             A[i][j] = std::complex<double>(a[j].ConvertToDouble(), 0);
         b[i] = std::complex<double>(prescale * LWECiphertexts[i]->GetB().ConvertToDouble(), 0);
@@ -1388,11 +1382,7 @@ Ciphertext<DCRTPoly> SWITCHCKKSRNS::EvalCompareSchemeSwitching(ConstCiphertext<D
     }
 
     auto LWECiphertexts = EvalCKKStoFHEW(cDiff, numCtxts);
-    const uint32_t n    = LWECiphertexts.size();
-    std::vector<LWECiphertext> cSigns(n);
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(n))
-    for (uint32_t i = 0; i < n; ++i)
-        cSigns[i] = m_ccLWE->EvalSign(LWECiphertexts[i], true);
+    auto cSigns         = m_ccLWE->EvalSign(LWECiphertexts, true);
 
     return EvalFHEWtoCKKS(cSigns, numCtxts, numSlots, 4, -1.0, 1.0, 0);
 }
@@ -1437,10 +1427,7 @@ std::vector<Ciphertext<DCRTPoly>> SWITCHCKKSRNS::EvalMinSchemeSwitching(ConstCip
 
         // Evaluate the sign
         // We always assume for the moment that numValues is a power of 2
-        std::vector<LWECiphertext> LWESign(n);
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(n))
-        for (uint32_t j = 0; j < n; ++j)
-            LWESign[j] = m_ccLWE->EvalSign(cTemp[j], true);
+        auto LWESign = m_ccLWE->EvalSign(cTemp, true);
 
         // Scheme switching from FHEW to CKKS
         auto dim1    = getRatioBSGSLT(n);
@@ -1513,10 +1500,11 @@ std::vector<Ciphertext<DCRTPoly>> SWITCHCKKSRNS::EvalMinSchemeSwitchingAlt(Const
 
         // Evaluate the sign
         // We always assume for the moment that numValues is a power of 2
+        auto tempSigns = m_ccLWE->EvalSign(cTemp, true);
         std::vector<LWECiphertext> LWESign(numValues);
 #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(n))
         for (uint32_t j = 0; j < n; ++j) {
-            LWECiphertext tempSign    = m_ccLWE->EvalSign(cTemp[j], true);
+            LWECiphertext tempSign    = tempSigns[j];
             LWECiphertext negTempSign = std::make_shared<LWECiphertextImpl>(*tempSign);
             m_ccLWE->GetLWEScheme()->EvalAddConstEq(negTempSign, negTempSign->GetModulus() >> 1);  // "negated" tempSign
             for (uint32_t i = 0; i < 2 * M; i += 2) {
@@ -1589,10 +1577,7 @@ std::vector<Ciphertext<DCRTPoly>> SWITCHCKKSRNS::EvalMaxSchemeSwitching(ConstCip
 
         // Evaluate the sign
         // We always assume for the moment that numValues is a power of 2
-        std::vector<LWECiphertext> LWESign(n);
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(n))
-        for (uint32_t j = 0; j < n; ++j)
-            LWESign[j] = m_ccLWE->EvalSign(cTemp[j], true);
+        auto LWESign = m_ccLWE->EvalSign(cTemp, true);
 
         // Scheme switching from FHEW to CKKS
         auto dim1    = getRatioBSGSLT(n);
@@ -1667,10 +1652,11 @@ std::vector<Ciphertext<DCRTPoly>> SWITCHCKKSRNS::EvalMaxSchemeSwitchingAlt(Const
 
         // Evaluate the sign
         // We always assume for the moment that numValues is a power of 2
+        auto tempSigns = m_ccLWE->EvalSign(cTemp, true);
         std::vector<LWECiphertext> LWESign(numValues);
 #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(n))
         for (uint32_t j = 0; j < n; ++j) {
-            LWECiphertext tempSign    = m_ccLWE->EvalSign(cTemp[j], true);
+            LWECiphertext tempSign    = tempSigns[j];
             LWECiphertext negTempSign = std::make_shared<LWECiphertextImpl>(*tempSign);
             m_ccLWE->GetLWEScheme()->EvalAddConstEq(negTempSign, negTempSign->GetModulus() >> 1);  // "negated" tempSign
             for (uint32_t i = 0; i < 2 * M; i += 2) {
@@ -33,7 +33,11 @@
 #include "key/privatekey.h"
 #include "cryptocontext.h"
 #include "schemebase/base-scheme.h"
+#include "utils/parallel.h"
 
+#include <algorithm>
+#include <functional>
+#include <iterator>
 #include <vector>
 #include <string>
 #include <memory>
@@ -44,28 +48,13 @@ namespace lbcrypto {
 
 template <class Element>
 Ciphertext<Element> AdvancedSHEBase<Element>::EvalAddMany(const std::vector<Ciphertext<Element>>& ciphertextVec) const {
-    const size_t inSize = ciphertextVec.size();
-
-    if (inSize == 0)
+    if (ciphertextVec.empty())
         OPENFHE_THROW("Input ciphertext vector is empty.");
 
-    if (inSize == 1)
-        return ciphertextVec[0];
-
-    const size_t lim = inSize * 2 - 2;
-    std::vector<Ciphertext<Element>> ciphertextSumVec;
-    ciphertextSumVec.resize(inSize - 1);
-    size_t ctrIndex = 0;
-
     auto algo = ciphertextVec[0]->GetCryptoContext()->GetScheme();
-
-    for (size_t i = 0; i < lim; i = i + 2) {
-        ciphertextSumVec[ctrIndex++] =
-            algo->EvalAdd(i < inSize ? ciphertextVec[i] : ciphertextSumVec[i - inSize],
-                          i + 1 < inSize ? ciphertextVec[i + 1] : ciphertextSumVec[i + 1 - inSize]);
-    }
-
-    return ciphertextSumVec.back();
+    return EvalReduceMany(ciphertextVec, [&algo](ConstCiphertext<Element>& ct1, ConstCiphertext<Element>& ct2) {
+        return algo->EvalAdd(ct1, ct2);
+    });
 }
 
 template <class Element>
@@ -100,22 +89,62 @@ Ciphertext<Element> AdvancedSHEBase<Element>::EvalMultMany(const std::vector<Cip
     if (ciphertextVec.size() < 1)
         OPENFHE_THROW("Input ciphertext vector size should be 1 or more");
 
-    const size_t inSize = ciphertextVec.size();
-    const size_t lim    = inSize * 2 - 2;
-    std::vector<Ciphertext<Element>> ciphertextMultVec;
-    ciphertextMultVec.resize(inSize - 1);
-    size_t ctrIndex = 0;
+    if (ciphertextVec.size() == 1)
+        return ciphertextVec[0]->Clone();
 
     auto algo = ciphertextVec[0]->GetCryptoContext()->GetScheme();
+    return EvalReduceMany(ciphertextVec,
+                          [&algo, &evalKeys](ConstCiphertext<Element>& ct1, ConstCiphertext<Element>& ct2) {
+                              auto result = algo->EvalMultAndRelinearize(ct1, ct2, evalKeys);
+                              algo->ModReduceInPlace(result, BASE_NUM_LEVELS_TO_DROP);
+                              return result;
+                          });
+}
+
+template <class Element>
+Ciphertext<Element> AdvancedSHEBase<Element>::EvalReduceMany(
+    const std::vector<Ciphertext<Element>>& ciphertextVec,
+    const std::function<Ciphertext<Element>(ConstCiphertext<Element>&, ConstCiphertext<Element>&)>& op,
+    bool parallel) const {
+    if (ciphertextVec.empty())
+        OPENFHE_THROW("Input ciphertext vector is empty.");
+    if (!op)
+        OPENFHE_THROW("Reduction operation is empty");
+    for (const auto& ct : ciphertextVec) {
+        if (!ct)
+            OPENFHE_THROW("Input ciphertext is nullptr");
+    }
 
-    for (size_t i = 0; i < lim; i = i + 2) {
-        ciphertextMultVec[ctrIndex] = algo->EvalMultAndRelinearize(
-            i < inSize ? ciphertextVec[i] : ciphertextMultVec[i - inSize],
-            i + 1 < inSize ? ciphertextVec[i + 1] : ciphertextMultVec[i + 1 - inSize], evalKeys);
-        algo->ModReduceInPlace(ciphertextMultVec[ctrIndex++], BASE_NUM_LEVELS_TO_DROP);
+    // a pending rescaling (noise scale degree > 1) costs one more level at the next multiplication
+    auto depth = [](const Ciphertext<Element>& ct) {
+        return ct->GetLevel() + ct->GetNoiseScaleDeg() - 1;
+    };
+
+    std::vector<Ciphertext<Element>> operands(ciphertextVec);
+    while (operands.size() > 1) {
+        std::stable_sort(operands.begin(), operands.end(),
+                         [&depth](const Ciphertext<Element>& a, const Ciphertext<Element>& b) {
+                             return depth(a) < depth(b);
+                         });
+
+        // pair up the shallowest operands; operands deeper than the second shallowest one are
+        // carried over to the next round so that the shallow ones can catch up first
+        const size_t maxDepth = depth(operands[1]);
+        size_t numPairs       = 0;
+        while (2 * numPairs + 1 < operands.size() && depth(operands[2 * numPairs + 1]) <= maxDepth)
+            ++numPairs;
+
+        std::vector<Ciphertext<Element>> results(numPairs);
+#pragma omp parallel for if (parallel) num_threads(OpenFHEParallelControls.GetThreadLimit(numPairs))
+        for (size_t i = 0; i < numPairs; ++i)
+            results[i] = op(operands[2 * i], operands[2 * i + 1]);
+
+        results.insert(results.end(), std::make_move_iterator(operands.begin() + 2 * numPairs),
+                       std::make_move_iterator(operands.end()));
+        operands = std::move(results);
     }
 
-    return ciphertextMultVec.back();
+    return operands[0];
 }
 
 template <class Element>
@@ -38,8 +38,11 @@
 #include "schemebase/base-pke.h"
 #include "schemebase/base-scheme.h"
 #include "schemebase/rlwe-cryptoparameters.h"
+#include "utils/parallel.h"
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <utility>
@@ -273,13 +276,7 @@ DecryptResult MultipartyBase<Element>::MultipartyDecryptFusion(const std::vector
     const auto cryptoParams =
         std::dynamic_pointer_cast<CryptoParametersRLWE<Element>>(ciphertextVec[0]->GetCryptoParameters());
 
-    const std::vector<Element>& cv0 = ciphertextVec[0]->GetElements();
-
-    Element b = cv0[0];
-    for (size_t i = 1; i < ciphertextVec.size(); i++) {
-        const std::vector<Element>& cvi = ciphertextVec[i]->GetElements();
-        b += cvi[0];
-    }
+    Element b = SumPartialDecryptions(ciphertextVec);
     b.SetFormat(Format::COEFFICIENT);
 
     *plaintext = b.ToNativePoly();
@@ -386,30 +383,190 @@ template <class Element>
 std::shared_ptr<std::map<uint32_t, EvalKey<Element>>> MultipartyBase<Element>::MultiAddEvalAutomorphismKeys(
     const std::shared_ptr<std::map<uint32_t, EvalKey<Element>>> evalKeyMap1,
     const std::shared_ptr<std::map<uint32_t, EvalKey<Element>>> evalKeyMap2) const {
-    auto evalKeyMapAuto = std::make_shared<std::map<uint32_t, EvalKey<Element>>>();
-
-    for (auto it = evalKeyMap1->begin(); it != evalKeyMap1->end(); ++it) {
-        auto it2 = evalKeyMap2->find(it->first);
-        if (it2 != evalKeyMap2->end())
-            (*evalKeyMapAuto)[it->first] = MultiAddEvalKeys(it->second, it2->second);
-    }
-
-    return evalKeyMapAuto;
+    return MultiAddEvalAutomorphismKeys({evalKeyMap1, evalKeyMap2});
 }
 
 template <class Element>
 std::shared_ptr<std::map<uint32_t, EvalKey<Element>>> MultipartyBase<Element>::MultiAddEvalSumKeys(
     const std::shared_ptr<std::map<uint32_t, EvalKey<Element>>> evalKeyMap1,
     const std::shared_ptr<std::map<uint32_t, EvalKey<Element>>> evalKeyMap2) const {
-    auto EvalKeyMapSum = std::make_shared<std::map<uint32_t, EvalKey<Element>>>();
+    return MultiAddEvalAutomorphismKeys({evalKeyMap1, evalKeyMap2});
+}
+
+template <class Element>
+PublicKey<Element> MultipartyBase<Element>::MultiAddPubKeys(const std::vector<PublicKey<Element>>& publicKeyVec) const {
+    if (publicKeyVec.empty())
+        OPENFHE_THROW("Input public key vector is empty");
+
+    auto b = SumAcrossParties(publicKeyVec.size(), 1, [&publicKeyVec](uint32_t p, uint32_t) -> const Element& {
+        return publicKeyVec[p]->GetPublicElements()[0];
+    });
+
+    PublicKey<Element> publicKeySum = std::make_shared<PublicKeyImpl<Element>>(publicKeyVec[0]->GetCryptoContext());
+    publicKeySum->SetPublicElements(std::vector<Element>{std::move(b[0]), publicKeyVec[0]->GetPublicElements()[1]});
+    return publicKeySum;
+}
 
-    for (auto it = evalKeyMap1->begin(); it != evalKeyMap1->end(); ++it) {
-        auto it2 = evalKeyMap2->find(it->first);
-        if (it2 != evalKeyMap2->end())
-            (*EvalKeyMapSum)[it->first] = MultiAddEvalKeys(it->second, it2->second);
+template <class Element>
+EvalKey<Element> MultipartyBase<Element>::MultiAddEvalKeys(const std::vector<EvalKey<Element>>& evalKeyVec) const {
+    if (evalKeyVec.empty())
+        OPENFHE_THROW("Input evaluation key vector is empty");
+
+    const std::vector<Element>& a = evalKeyVec[0]->GetAVector();
+    const uint32_t numDigits      = a.size();
+    for (const auto& evalKey : evalKeyVec) {
+        if (evalKey->GetBVector().size() != numDigits)
+            OPENFHE_THROW("Evaluation keys of the parties have different sizes");
+    }
+
+    auto b = SumAcrossParties(evalKeyVec.size(), numDigits, [&evalKeyVec](uint32_t p, uint32_t i) -> const Element& {
+        return evalKeyVec[p]->GetBVector()[i];
+    });
+
+    EvalKey<Element> evalKeySum = std::make_shared<EvalKeyRelinImpl<Element>>(evalKeyVec[0]->GetCryptoContext());
+    evalKeySum->SetAVector(a);
+    evalKeySum->SetBVector(std::move(b));
+    return evalKeySum;
+}
+
+template <class Element>
+EvalKey<Element> MultipartyBase<Element>::MultiAddEvalMultKeys(const std::vector<EvalKey<Element>>& evalKeyVec) const {
+    if (evalKeyVec.empty())
+        OPENFHE_THROW("Input evaluation key vector is empty");
+
+    const uint32_t numDigits = evalKeyVec[0]->GetAVector().size();
+    for (const auto& evalKey : evalKeyVec) {
+        if (evalKey->GetAVector().size() != numDigits || evalKey->GetBVector().size() != numDigits)
+            OPENFHE_THROW("Evaluation keys of the parties have different sizes");
     }
 
-    return EvalKeyMapSum;
+    // the a and b vectors are summed in a single pass: positions [0, numDigits) hold a, the rest hold b
+    auto ab = SumAcrossParties(evalKeyVec.size(), 2 * numDigits,
+                               [&evalKeyVec, numDigits](uint32_t p, uint32_t i) -> const Element& {
+                                   return (i < numDigits) ? evalKeyVec[p]->GetAVector()[i] :
+                                                            evalKeyVec[p]->GetBVector()[i - numDigits];
+                               });
+
+    EvalKey<Element> evalKeySum = std::make_shared<EvalKeyRelinImpl<Element>>(evalKeyVec[0]->GetCryptoContext());
+    evalKeySum->SetAVector(std::vector<Element>(std::make_move_iterator(ab.begin()),
+                                                std::make_move_iterator(ab.begin() + numDigits)));
+    evalKeySum->SetBVector(std::vector<Element>(std::make_move_iterator(ab.begin() + numDigits),
+                                                std::make_move_iterator(ab.end())));
+    return evalKeySum;
+}
+
+template <class Element>
+std::shared_ptr<std::map<uint32_t, EvalKey<Element>>> MultipartyBase<Element>::MultiAddEvalAutomorphismKeys(
+    const std::vector<std::shared_ptr<std::map<uint32_t, EvalKey<Element>>>>& evalKeyMapVec) const {
+    if (evalKeyMapVec.empty())
+        OPENFHE_THROW("Input evaluation key map vector is empty");
+    for (const auto& evalKeyMap : evalKeyMapVec) {
+        if (!evalKeyMap)
+            OPENFHE_THROW("Input evaluation key map is nullptr");
+    }
+
+    const uint32_t numParties = evalKeyMapVec.size();
+
+    // collect the b vectors of the indices present in every key set; the digits of all indices
+    // are flattened so that a single parallel reduction covers the whole key set
+    std::vector<uint32_t> indices;
+    std::vector<std::vector<const std::vector<Element>*>> bVectors(numParties);
+    std::vector<uint32_t> offsets{0};
+    for (const auto& [index, evalKey] : *evalKeyMapVec[0]) {
+        const uint32_t numDigits = evalKey->GetBVector().size();
+        std::vector<const std::vector<Element>*> parties(numParties);
+        bool present = true;
+        for (uint32_t p = 0; p < numParties && present; ++p) {
+            auto it = evalKeyMapVec[p]->find(index);
+            present = (it != evalKeyMapVec[p]->end());
+            if (present) {
+                parties[p] = &it->second->GetBVector();
+                if (parties[p]->size() != numDigits)
+                    OPENFHE_THROW("Evaluation keys of the parties have different sizes");
+            }
+        }
+        if (!present)
+            continue;
+        indices.push_back(index);
+        for (uint32_t p = 0; p < numParties; ++p)
+            bVectors[p].push_back(parties[p]);
+        offsets.push_back(offsets.back() + numDigits);
+    }
+
+    auto evalKeyMapSum = std::make_shared<std::map<uint32_t, EvalKey<Element>>>();
+    if (indices.empty())
+        return evalKeyMapSum;
+
+    // position of each flattened digit: key number and digit within the key
+    std::vector<uint32_t> keyOf(offsets.back());
+    for (uint32_t k = 0; k < indices.size(); ++k)
+        std::fill(keyOf.begin() + offsets[k], keyOf.begin() + offsets[k + 1], k);
+
+    auto b = SumAcrossParties(numParties, offsets.back(),
+                              [&bVectors, &keyOf, &offsets](uint32_t p, uint32_t i) -> const Element& {
+                                  const uint32_t k = keyOf[i];
+                                  return (*bVectors[p][k])[i - offsets[k]];
+                              });
+
+    const auto cc = evalKeyMapVec[0]->begin()->second->GetCryptoContext();
+    for (uint32_t k = 0; k < indices.size(); ++k) {
+        EvalKey<Element> evalKeySum = std::make_shared<EvalKeyRelinImpl<Element>>(cc);
+        evalKeySum->SetAVector(evalKeyMapVec[0]->at(indices[k])->GetAVector());
+        evalKeySum->SetBVector(std::vector<Element>(std::make_move_iterator(b.begin() + offsets[k]),
+                                                    std::make_move_iterator(b.begin() + offsets[k + 1])));
+        (*evalKeyMapSum)[indices[k]] = std::move(evalKeySum);
+    }
+
+    return evalKeyMapSum;
+}
+
+template <class Element>
+std::vector<Element> MultipartyBase<Element>::SumAcrossParties(
+    uint32_t numParties, uint32_t numItems,
+    const std::function<const Element&(uint32_t party, uint32_t item)>& contribution) {
+    if (numParties == 0 || numItems == 0)
+        OPENFHE_THROW("No contributions to sum");
+
+    // enough groups to occupy all threads, but no more than needed: every group holds one partial sum per item
+    const uint32_t numThreads = OpenFHEParallelControls.GetThreadLimit(numParties * numItems);
+    const uint32_t maxGroups  = std::min(numParties, std::max(1u, numThreads / numItems));
+    const uint32_t groupSize  = (numParties + maxGroups - 1) / maxGroups;
+    const uint32_t numGroups  = (numParties + groupSize - 1) / groupSize;
+
+    std::vector<std::vector<Element>> sums(numGroups, std::vector<Element>(numItems));
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numGroups * numItems))
+    for (uint32_t k = 0; k < numGroups * numItems; ++k) {
+        const uint32_t g     = k / numItems;
+        const uint32_t i     = k % numItems;
+        const uint32_t first = g * groupSize;
+        const uint32_t last  = std::min(numParties, first + groupSize);
+        Element sum(contribution(first, i));
+        for (uint32_t p = first + 1; p < last; ++p)
+            sum += contribution(p, i);
+        sums[g][i] = std::move(sum);
+    }
+
+    for (uint32_t stride = 1; stride < numGroups; stride *= 2) {
+        const uint32_t numPairs = (numGroups + 2 * stride - 1) / (2 * stride);
+#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numPairs * numItems))
+        for (uint32_t k = 0; k < numPairs * numItems; ++k) {
+            const uint32_t g = (k / numItems) * 2 * stride;
+            const uint32_t i = k % numItems;
+            if (g + stride < numGroups)
+                sums[g][i] += sums[g + stride][i];
+        }
+    }
+
+    return std::move(sums[0]);
+}
+
+template <class Element>
+Element MultipartyBase<Element>::SumPartialDecryptions(const std::vector<Ciphertext<Element>>& ciphertextVec) {
+    if (ciphertextVec.empty())
+        OPENFHE_THROW("Input ciphertext vector is empty");
+    return SumAcrossParties(ciphertextVec.size(), 1, [&ciphertextVec](uint32_t p, uint32_t) -> const Element& {
+        return ciphertextVec[p]->GetElements()[0];
+    })[0];
 }
 
 }  // namespace lbcrypto
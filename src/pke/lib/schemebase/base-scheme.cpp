@@ -310,6 +310,47 @@ EvalKey<Element> SchemeBase<Element>::MultiAddEvalMultKeys(EvalKey<Element> eval
     return evalKeySum;
 }
 
+template <typename Element>
+PublicKey<Element> SchemeBase<Element>::MultiAddPubKeys(const std::vector<PublicKey<Element>>& publicKeyVec,
+                                                        const std::string& keyId) {
+    VerifyMultipartyEnabled(__func__);
+    auto publicKeySum = m_Multiparty->MultiAddPubKeys(publicKeyVec);
+    publicKeySum->SetKeyTag(keyId);
+    return publicKeySum;
+}
+
+template <typename Element>
+EvalKey<Element> SchemeBase<Element>::MultiAddEvalKeys(const std::vector<EvalKey<Element>>& evalKeyVec,
+                                                       const std::string& keyId) {
+    VerifyMultipartyEnabled(__func__);
+    auto evalKeySum = m_Multiparty->MultiAddEvalKeys(evalKeyVec);
+    evalKeySum->SetKeyTag(keyId);
+    return evalKeySum;
+}
+
+template <typename Element>
+EvalKey<Element> SchemeBase<Element>::MultiAddEvalMultKeys(const std::vector<EvalKey<Element>>& evalKeyVec,
+                                                           const std::string& keyId) {
+    VerifyMultipartyEnabled(__func__);
+    auto evalKeySum = m_Multiparty->MultiAddEvalMultKeys(evalKeyVec);
+    evalKeySum->SetKeyTag(keyId);
+    return evalKeySum;
+}
+
+template <typename Element>
+std::shared_ptr<std::map<uint32_t, EvalKey<Element>>> SchemeBase<Element>::MultiAddEvalAutomorphismKeys(
+    const std::vector<std::shared_ptr<std::map<uint32_t, EvalKey<Element>>>>& evalKeyMapVec,
+    const std::string& keyId) {
+    VerifyMultipartyEnabled(__func__);
+    auto result = m_Multiparty->MultiAddEvalAutomorphismKeys(evalKeyMapVec);
+    for (auto& key : *result) {
+        if (key.second) {
+            key.second->SetKeyTag(keyId);
+        }
+    }
+    return result;
+}
+
 template <typename Element>
 std::shared_ptr<std::map<uint32_t, EvalKey<Element>>> SchemeBase<Element>::EvalAutomorphismKeyGen(
     const PrivateKey<Element> privateKey, const std::vector<uint32_t>& indexList) const {
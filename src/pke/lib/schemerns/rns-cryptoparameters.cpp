@@ -154,7 +154,6 @@ void CryptoParametersRNS::PrecomputeCRTTables(KeySwitchTechnique ksTech, Scaling
         // moduliP holds special primes p1, p2, ..., pk
         // m_modulusP holds the product of special primes P = p1*p2*...pk
         std::vector<NativeInteger> moduliP(sizeP);
-        std::vector<NativeInteger> rootsP(sizeP);
         // firstP contains a prime whose size is PModSize.
         NativeInteger firstP = FirstPrime<NativeInteger>(auxBits, primeStep);
         NativeInteger pPrev  = firstP;
@@ -171,10 +170,11 @@ void CryptoParametersRNS::PrecomputeCRTTables(KeySwitchTechnique ksTech, Scaling
                         foundInQ = true;
                 pPrev = moduliP[i];
             } while (foundInQ);
-            rootsP[i] = RootOfUnity<NativeInteger>(2 * n, moduliP[i]);
             modulusP *= moduliP[i];
             pPrev = moduliP[i];
         }
+        // the roots for different primes are independent, so they are searched for concurrently
+        std::vector<NativeInteger> rootsP = RootsOfUnity<NativeInteger>(2 * n, moduliP);
 
         // Store the created moduli and roots in m_paramsP
         m_paramsP = std::make_shared<ILDCRTParams<BigInteger>>(2 * n, moduliP, rootsP);
@@ -112,3 +112,50 @@ TEST_F(UTGENERAL_CRYPTOCONTEXTS, coexisting_ckks_cryptocontexts) {
     EXPECT_TRUE(checkEquality(values, results->GetRealPackedValue(), epsilon))
         << "static data for the first cryptocontext may be overriden";
 }
+
+TEST_F(UTGENERAL_CRYPTOCONTEXTS, cryptocontext_registry) {
+    CCParams<CryptoContextCKKSRNS> parameters1;
+    parameters1.SetMultiplicativeDepth(1);
+    parameters1.SetScalingModSize(30);
+    parameters1.SetRingDim(16);
+    parameters1.SetBatchSize(4);
+    parameters1.SetSecurityLevel(HEStd_NotSet);
+
+    CCParams<CryptoContextCKKSRNS> parameters2(parameters1);
+    parameters2.SetMultiplicativeDepth(2);
+
+    // equal parameters map to the same context, also when requested concurrently
+    constexpr uint32_t numRequests = 16;
+    std::vector<CryptoContext<DCRTPoly>> contexts(numRequests);
+#pragma omp parallel for
+    for (uint32_t i = 0; i < numRequests; ++i)
+        contexts[i] = GenCryptoContext((i & 1) ? parameters2 : parameters1);
+
+    auto cc1 = contexts[0];
+    auto cc2 = contexts[1];
+    EXPECT_NE(cc1, cc2);
+    for (uint32_t i = 0; i < numRequests; ++i)
+        EXPECT_EQ(contexts[i], (i & 1) ? cc2 : cc1) << "request " << i;
+    EXPECT_EQ(CryptoContextFactory<DCRTPoly>::GetContextCount(), 2);
+
+    EXPECT_EQ(CryptoContextFactory<DCRTPoly>::GetContextForPointer(cc1.get()), cc1);
+    EXPECT_EQ(CryptoContextFactory<DCRTPoly>::GetContextForPointer(cc2.get()), cc2);
+
+    // a released context is no longer found, and a new one is created for its parameters
+    cc1->Enable(PKE);
+    cc1->Enable(KEYSWITCH);
+    cc1->Enable(LEVELEDSHE);
+    auto keys = cc1->KeyGen();
+    cc1->EvalMultKeyGen(keys.secretKey);
+    EXPECT_TRUE(CryptoContextFactory<DCRTPoly>::ReleaseContext(cc1));
+    EXPECT_FALSE(CryptoContextFactory<DCRTPoly>::ReleaseContext(cc1));
+    EXPECT_EQ(CryptoContextFactory<DCRTPoly>::GetContextCount(), 1);
+    EXPECT_EQ(CryptoContextFactory<DCRTPoly>::GetContextForPointer(cc1.get()), nullptr);
+    EXPECT_EQ(CryptoContextImpl<DCRTPoly>::GetAllEvalMultKeys().count(keys.secretKey->GetKeyTag()), 0U)
+        << "the evaluation keys of a released context must be cleared";
+
+    auto cc3 = GenCryptoContext(parameters1);
+    EXPECT_NE(cc3, cc1);
+    EXPECT_EQ(GenCryptoContext(parameters2), cc2);
+    EXPECT_EQ(CryptoContextFactory<DCRTPoly>::GetContextCount(), 2);
+}
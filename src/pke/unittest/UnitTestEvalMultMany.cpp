@@ -34,6 +34,7 @@
 #include "gen-cryptocontext.h"
 #include "gtest/gtest.h"
 #include "scheme/bfvrns/gen-cryptocontext-bfvrns.h"
+#include "scheme/bgvrns/gen-cryptocontext-bgvrns.h"
 #include "utils/debug.h"
 
 #include <fstream>
@@ -71,6 +72,20 @@ static CryptoContext<DCRTPoly> MakeBFVrnsDCRTPolyCC() {
     return cryptoContext;
 }
 
+static CryptoContext<DCRTPoly> MakeBGVrnsDCRTPolyCC() {
+    CCParams<CryptoContextBGVRNS> parameters;
+    parameters.SetPlaintextModulus(65537);
+    parameters.SetMultiplicativeDepth(4);
+
+    CryptoContext<DCRTPoly> cryptoContext = GenCryptoContext(parameters);
+    cryptoContext->Enable(PKE);
+    cryptoContext->Enable(KEYSWITCH);
+    cryptoContext->Enable(LEVELEDSHE);
+    cryptoContext->Enable(ADVANCEDSHE);
+
+    return cryptoContext;
+}
+
 template <typename Element>
 static void RunEvalMultManyTest(CryptoContext<Element> cc, std::string msg);
 
@@ -182,3 +197,43 @@ static void RunEvalMultManyTest(CryptoContext<Element> cryptoContext, std::strin
     EXPECT_EQ(*plaintextMul3, *plaintextResult3) << msg << ".EvalMultAndRelinearize gives incorrect results.\n";
     EXPECT_EQ(*plaintextMulMany, *plaintextResult3) << msg << ".EvalMultMany gives incorrect results.\n";
 }
+
+// Tests the tree reductions on ciphertexts at different levels
+TEST(UTGENERAL_EVAL_MULT_MANY, BGVrns_Eval_Reduce_Many_Mixed_Levels) {
+    auto cc      = MakeBGVrnsDCRTPolyCC();
+    auto keyPair = cc->KeyGen();
+    cc->EvalMultKeyGen(keyPair.secretKey);
+
+    std::vector<std::vector<int64_t>> values = {{1, 2, 3, 4}, {2, 2, 2, 2}, {3, 1, 2, 1}, {1, 3, 1, 2}, {2, 1, 1, 3}};
+    std::vector<Ciphertext<DCRTPoly>> ciphertexts;
+    for (const auto& v : values)
+        ciphertexts.push_back(cc->Encrypt(keyPair.publicKey, cc->MakePackedPlaintext(v)));
+    // a deeper operand that the reduction has to schedule last
+    ciphertexts.push_back(cc->EvalMult(ciphertexts[0], ciphertexts[1]));
+
+    std::vector<int64_t> product(4, 1), sum(4, 0);
+    for (size_t i = 0; i < product.size(); ++i) {
+        for (const auto& v : values) {
+            product[i] *= v[i];
+            sum[i] += v[i];
+        }
+        product[i] *= values[0][i] * values[1][i];
+        sum[i] += values[0][i] * values[1][i];
+    }
+
+    Plaintext result;
+    cc->Decrypt(keyPair.secretKey, cc->EvalMultMany(ciphertexts), &result);
+    result->SetLength(product.size());
+    EXPECT_EQ(result->GetPackedValue(), product) << "EvalMultMany gives incorrect results";
+
+    cc->Decrypt(keyPair.secretKey, cc->EvalAddMany(ciphertexts), &result);
+    result->SetLength(sum.size());
+    EXPECT_EQ(result->GetPackedValue(), sum) << "EvalAddMany gives incorrect results";
+
+    auto multOp = [&cc](ConstCiphertext<DCRTPoly>& ct1, ConstCiphertext<DCRTPoly>& ct2) {
+        return cc->EvalMult(ct1, ct2);
+    };
+    cc->Decrypt(keyPair.secretKey, cc->EvalReduceMany(ciphertexts, multOp, false), &result);
+    result->SetLength(product.size());
+    EXPECT_EQ(result->GetPackedValue(), product) << "EvalReduceMany gives incorrect results";
+}
@@ -29,7 +29,9 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //==================================================================================
 
+#include "gen-cryptocontext.h"
 #include "include/gtest/gtest.h"
+#include "scheme/bgvrns/gen-cryptocontext-bgvrns.h"
 #include "utils/exception.h"
 #include "UnitTestCCParams.h"
 #include "UnitTestCryptoContext.h"
@@ -1027,3 +1029,85 @@ TEST_P(UTGENERAL_MULTIPARTY, Multiparty) {
 }
 
 INSTANTIATE_TEST_SUITE_P(UnitTests, UTGENERAL_MULTIPARTY, ::testing::ValuesIn(testCases), testName);
+
+//===========================================================================================================
+// Aggregating the contributions of all parties at once must match the pairwise aggregation
+TEST(UTGENERAL_MULTIPARTY_AGGREGATION, AllPartiesAtOnce) {
+    CCParams<CryptoContextBGVRNS> parameters;
+    parameters.SetPlaintextModulus(65537);
+    parameters.SetMultiplicativeDepth(2);
+    parameters.SetBatchSize(16);
+
+    CryptoContext<DCRTPoly> cc = GenCryptoContext(parameters);
+    cc->Enable(PKE);
+    cc->Enable(KEYSWITCH);
+    cc->Enable(LEVELEDSHE);
+    cc->Enable(ADVANCEDSHE);
+    cc->Enable(MULTIPARTY);
+
+    const uint32_t numParties = 5;
+    std::vector<KeyPair<DCRTPoly>> kps{cc->KeyGen()};
+    for (uint32_t i = 1; i < numParties; ++i)
+        kps.push_back(cc->MultipartyKeyGen(kps.back().publicKey));
+    const std::string keyTag = kps.back().publicKey->GetKeyTag();
+
+    auto evalMultKey = cc->KeySwitchGen(kps[0].secretKey, kps[0].secretKey);
+    cc->EvalSumKeyGen(kps[0].secretKey);
+    auto evalSumKeys =
+        std::make_shared<std::map<uint32_t, EvalKey<DCRTPoly>>>(cc->GetEvalSumKeyMap(kps[0].secretKey->GetKeyTag()));
+
+    std::vector<EvalKey<DCRTPoly>> evalMultKeys{evalMultKey};
+    std::vector<std::shared_ptr<std::map<uint32_t, EvalKey<DCRTPoly>>>> evalSumKeysVec{evalSumKeys};
+    for (uint32_t i = 1; i < numParties; ++i) {
+        evalMultKeys.push_back(cc->MultiKeySwitchGen(kps[i].secretKey, kps[i].secretKey, evalMultKey));
+        evalSumKeysVec.push_back(cc->MultiEvalSumKeyGen(kps[i].secretKey, evalSumKeys, keyTag));
+    }
+
+    auto evalMultJoint = cc->MultiAddEvalKeys(evalMultKeys, keyTag);
+    auto evalSumJoint  = cc->MultiAddEvalAutomorphismKeys(evalSumKeysVec, keyTag);
+
+    auto evalMultFold = evalMultKeys[0];
+    auto evalSumFold  = evalSumKeysVec[0];
+    for (uint32_t i = 1; i < numParties; ++i) {
+        evalMultFold = cc->MultiAddEvalKeys(evalMultFold, evalMultKeys[i], keyTag);
+        evalSumFold  = cc->MultiAddEvalSumKeys(evalSumFold, evalSumKeysVec[i], keyTag);
+    }
+
+    EXPECT_EQ(evalMultJoint->GetAVector(), evalMultFold->GetAVector());
+    EXPECT_EQ(evalMultJoint->GetBVector(), evalMultFold->GetBVector());
+    EXPECT_EQ(evalMultJoint->GetKeyTag(), keyTag);
+    ASSERT_EQ(evalSumJoint->size(), evalSumFold->size());
+    for (const auto& [index, evalKey] : *evalSumFold) {
+        ASSERT_EQ(evalSumJoint->count(index), 1u) << "missing automorphism index " << index;
+        EXPECT_EQ(evalSumJoint->at(index)->GetBVector(), evalKey->GetBVector()) << "automorphism index " << index;
+    }
+
+    std::vector<EvalKey<DCRTPoly>> evalMultShares;
+    for (uint32_t i = 0; i < numParties; ++i)
+        evalMultShares.push_back(cc->MultiMultEvalKey(kps[i].secretKey, evalMultJoint, keyTag));
+    auto evalMultFinal = cc->MultiAddEvalMultKeys(evalMultShares, keyTag);
+    cc->InsertEvalMultKey({evalMultFinal});
+    cc->InsertEvalSumKey(evalSumJoint);
+
+    std::vector<int64_t> vectorOfInts1 = {1, 2, 3, 4, 5, 6, 5, 4, 3, 2, 1, 0};
+    std::vector<int64_t> vectorOfInts2 = {2, 2, 3, 4, 5, 6, 7, 8, 9, 10, 0, 0};
+    auto ciphertext1 = cc->Encrypt(kps.back().publicKey, cc->MakePackedPlaintext(vectorOfInts1));
+    auto ciphertext2 = cc->Encrypt(kps.back().publicKey, cc->MakePackedPlaintext(vectorOfInts2));
+    auto ciphertext  = cc->EvalSum(cc->EvalMult(ciphertext1, ciphertext2), 16);
+
+    std::vector<Ciphertext<DCRTPoly>> partialCiphertextVec;
+    partialCiphertextVec.push_back(cc->MultipartyDecryptLead({ciphertext}, kps[0].secretKey)[0]);
+    for (uint32_t i = 1; i < numParties; ++i)
+        partialCiphertextVec.push_back(cc->MultipartyDecryptMain({ciphertext}, kps[i].secretKey)[0]);
+
+    Plaintext plaintextMultiparty;
+    cc->MultipartyDecryptFusion(partialCiphertextVec, &plaintextMultiparty);
+    plaintextMultiparty->SetLength(vectorOfInts1.size());
+
+    std::vector<int64_t> expected(vectorOfInts1.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        for (size_t j = i; j < expected.size(); ++j)
+            expected[i] += vectorOfInts1[j] * vectorOfInts2[j];
+    }
+    EXPECT_EQ(plaintextMultiparty->GetPackedValue(), expected) << "Multiparty: joint keys give incorrect results";
+}
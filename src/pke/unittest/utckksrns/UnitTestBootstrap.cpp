@@ -58,6 +58,10 @@ enum TEST_CASE_TYPE : int {
     BOOTSTRAP_NUM_TOWERS,
     BOOTSTRAP_SERIALIZE,
     BOOTSTRAP_SPARSE_ENCAPSULATED,
+    BOOTSTRAP_PRECOMPUTE_SERIALIZE,
+    BOOTSTRAP_COMPACT,
+    BOOTSTRAP_BATCH,
+    BOOTSTRAP_KEY_SET,
 };
 
 static std::ostream& operator<<(std::ostream& os, const TEST_CASE_TYPE& type) {
@@ -87,6 +91,18 @@ static std::ostream& operator<<(std::ostream& os, const TEST_CASE_TYPE& type) {
         case BOOTSTRAP_SPARSE_ENCAPSULATED:
             typeName = "BOOTSTRAP_SPARSE_ENCAPSULATED";
             break;
+        case BOOTSTRAP_PRECOMPUTE_SERIALIZE:
+            typeName = "BOOTSTRAP_PRECOMPUTE_SERIALIZE";
+            break;
+        case BOOTSTRAP_COMPACT:
+            typeName = "BOOTSTRAP_COMPACT";
+            break;
+        case BOOTSTRAP_BATCH:
+            typeName = "BOOTSTRAP_BATCH";
+            break;
+        case BOOTSTRAP_KEY_SET:
+            typeName = "BOOTSTRAP_KEY_SET";
+            break;
         default:
             typeName = "UNKNOWN";
             break;
@@ -370,6 +386,30 @@ static std::vector<TEST_CASE_UTCKKSRNS_BOOT> testCases = {
     { BOOTSTRAP_SERIALIZE, "07", {CKKSRNS_SCHEME, RDIM, MULT_DEPTH, SMODSIZE,  DFLT,  DFLT,     UNIFORM_TERNARY, DFLT, FMODSIZE, HEStd_NotSet, HYBRID,       FIXEDAUTO, NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,   DFLT,  DFLT,   DFLT,      DFLT, DFLT, DFLT, COMPLEX},   { 2, 2 },  { 0, 0 },   RDIM/2 },
     { BOOTSTRAP_SERIALIZE, "08", {CKKSRNS_SCHEME, RDIM, MULT_DEPTH, SMODSIZE,  DFLT,  DFLT, SPARSE_ENCAPSULATED, DFLT, FMODSIZE, HEStd_NotSet, HYBRID,       FIXEDAUTO, NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,   DFLT,  DFLT,   DFLT,      DFLT, DFLT, DFLT, REAL},   { 2, 2 },  { 4, 4 },   RDIM/2 },
     // ==========================================
+    // TestType,                     Descr,          Scheme, RDim,  MultDepth, SModSize, DSize, BSize, SecKeyDist, MaxRelinSkDeg, FModSize,       SecLvl, KSTech,        ScalTech,      LDigits, PtMod,StdDev, EvalAddCt, KSCt, MultTech, EncTech, PREMode, MultipartyMode, decryptionNoiseMode, ExecutionMode, NoiseEstimate, RegisterWordSize, CompositeDegree, CKKSDataType, LvlBudget, Dim1,       Slots
+    { BOOTSTRAP_PRECOMPUTE_SERIALIZE, "01", {CKKSRNS_SCHEME, RDIM, MULT_DEPTH, SMODSIZE,  DFLT,  DFLT,     UNIFORM_TERNARY, DFLT, FMODSIZE, HEStd_NotSet, HYBRID,       FIXEDAUTO, NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,   DFLT,  DFLT,   DFLT,      DFLT, DFLT, DFLT, REAL},   { 1, 1 },  { 32, 32 }, RDIM/2 },
+    { BOOTSTRAP_PRECOMPUTE_SERIALIZE, "02", {CKKSRNS_SCHEME, RDIM, MULT_DEPTH, SMODSIZE,  DFLT,  DFLT,     UNIFORM_TERNARY, DFLT, FMODSIZE, HEStd_NotSet, HYBRID,       FIXEDAUTO, NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,   DFLT,  DFLT,   DFLT,      DFLT, DFLT, DFLT, REAL},   { 2, 2 },  { 0, 0 },   RDIM/2 },
+    { BOOTSTRAP_PRECOMPUTE_SERIALIZE, "03", {CKKSRNS_SCHEME, RDIM, MULT_DEPTH, SMODSIZE,  DFLT,  DFLT,     UNIFORM_TERNARY, DFLT, FMODSIZE, HEStd_NotSet, HYBRID,       FIXEDAUTO, NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,   DFLT,  DFLT,   DFLT,      DFLT, DFLT, DFLT, COMPLEX},   { 2, 2 },  { 0, 0 },   RDIM/2 },
+    // ==========================================
+    // TestType,     Descr,          Scheme, RDim,  MultDepth, SModSize, DSize, BSize, SecKeyDist, MaxRelinSkDeg, FModSize,       SecLvl, KSTech,        ScalTech,      LDigits, PtMod,StdDev, EvalAddCt, KSCt, MultTech, EncTech, PREMode, MultipartyMode, decryptionNoiseMode, ExecutionMode, NoiseEstimate, RegisterWordSize, CompositeDegree, CKKSDataType, LvlBudget, Dim1,       Slots
+    { BOOTSTRAP_COMPACT, "01", {CKKSRNS_SCHEME, RDIM, MULT_DEPTH, SMODSIZE,  DFLT,  DFLT,     UNIFORM_TERNARY, DFLT, FMODSIZE, HEStd_NotSet, HYBRID,       FIXEDAUTO, NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,   DFLT,  DFLT,   DFLT,      DFLT, DFLT, DFLT, REAL},   { 1, 1 },  { 32, 32 }, RDIM/2 },
+    { BOOTSTRAP_COMPACT, "02", {CKKSRNS_SCHEME, RDIM, MULT_DEPTH, SMODSIZE,  DFLT,  DFLT,     UNIFORM_TERNARY, DFLT, FMODSIZE, HEStd_NotSet, HYBRID,       FIXEDAUTO, NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,   DFLT,  DFLT,   DFLT,      DFLT, DFLT, DFLT, REAL},   { 3, 3 },  { 0, 0 }, RDIM/2 },
+    { BOOTSTRAP_COMPACT, "03", {CKKSRNS_SCHEME, RDIM, MULT_DEPTH, SMODSIZE,  DFLT,  DFLT,      SPARSE_TERNARY, DFLT, FMODSIZE, HEStd_NotSet, HYBRID,       FIXEDAUTO, NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,   DFLT,  DFLT,   DFLT,      DFLT, DFLT, DFLT, COMPLEX},   { 1, 1 },  { 0, 0 }, RDIM/4 },
+    { BOOTSTRAP_COMPACT, "04", {CKKSRNS_SCHEME, RDIM, MULT_DEPTH, SMODSIZE,  DFLT,  DFLT,     UNIFORM_TERNARY, DFLT, FMODSIZE, HEStd_NotSet, HYBRID,       FIXEDAUTO, NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,   DFLT,  DFLT,   DFLT,      DFLT, DFLT, DFLT, REAL},   { 2, 2 },  { 0, 0 }, RDIM/4 },
+    // ==========================================
+    // TestType,     Descr,          Scheme, RDim,  MultDepth, SModSize, DSize, BSize, SecKeyDist, MaxRelinSkDeg, FModSize,       SecLvl, KSTech,        ScalTech,      LDigits, PtMod,StdDev, EvalAddCt, KSCt, MultTech, EncTech, PREMode, MultipartyMode, decryptionNoiseMode, ExecutionMode, NoiseEstimate, RegisterWordSize, CompositeDegree, CKKSDataType, LvlBudget, Dim1,       Slots
+    { BOOTSTRAP_BATCH, "01", {CKKSRNS_SCHEME, RDIM, MULT_DEPTH, SMODSIZE,  DFLT,  DFLT,     UNIFORM_TERNARY, DFLT, FMODSIZE, HEStd_NotSet, HYBRID,       FIXEDAUTO, NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,   DFLT,  DFLT,   DFLT,      DFLT, DFLT, DFLT, REAL},   { 1, 1 },  { 32, 32 }, RDIM/2 },
+    { BOOTSTRAP_BATCH, "02", {CKKSRNS_SCHEME, RDIM, MULT_DEPTH, SMODSIZE,  DFLT,  DFLT,     UNIFORM_TERNARY, DFLT, FMODSIZE, HEStd_NotSet, HYBRID,       FIXEDAUTO, NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,   DFLT,  DFLT,   DFLT,      DFLT, DFLT, DFLT, REAL},   { 3, 3 },  { 0, 0 }, RDIM/2 },
+    { BOOTSTRAP_BATCH, "03", {CKKSRNS_SCHEME, RDIM, MULT_DEPTH, SMODSIZE,  DFLT,  DFLT,      SPARSE_TERNARY, DFLT, FMODSIZE, HEStd_NotSet, HYBRID,       FIXEDAUTO, NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,   DFLT,  DFLT,   DFLT,      DFLT, DFLT, DFLT, COMPLEX},   { 1, 1 },  { 0, 0 }, RDIM/4 },
+    { BOOTSTRAP_BATCH, "04", {CKKSRNS_SCHEME, RDIM, MULT_DEPTH, SMODSIZE,  DFLT,  DFLT,     UNIFORM_TERNARY, DFLT, FMODSIZE, HEStd_NotSet, HYBRID,       FIXEDAUTO, NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,   DFLT,  DFLT,   DFLT,      DFLT, DFLT, DFLT, REAL},   { 2, 2 },  { 0, 0 }, RDIM/4 },
+    { BOOTSTRAP_BATCH, "05", {CKKSRNS_SCHEME, RDIM, MULT_DEPTH, SMODSIZE,  DFLT,  DFLT,     UNIFORM_TERNARY, DFLT, FMODSIZE, HEStd_NotSet, HYBRID,     FIXEDMANUAL, NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,   DFLT,  DFLT,   DFLT,      DFLT, DFLT, DFLT, REAL},   { 3, 3 },  { 0, 0 }, RDIM/2 },
+    // ==========================================
+    // TestType,     Descr,          Scheme, RDim,  MultDepth, SModSize, DSize, BSize, SecKeyDist, MaxRelinSkDeg, FModSize,       SecLvl, KSTech,        ScalTech,      LDigits, PtMod,StdDev, EvalAddCt, KSCt, MultTech, EncTech, PREMode, MultipartyMode, decryptionNoiseMode, ExecutionMode, NoiseEstimate, RegisterWordSize, CompositeDegree, CKKSDataType, LvlBudget, Dim1,       Slots
+    { BOOTSTRAP_KEY_SET, "01", {CKKSRNS_SCHEME, RDIM, MULT_DEPTH, SMODSIZE,  DFLT,  DFLT,     UNIFORM_TERNARY, DFLT, FMODSIZE, HEStd_NotSet, HYBRID,       FIXEDAUTO, NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,   DFLT,  DFLT,   DFLT,      DFLT, DFLT, DFLT, REAL},   { 2, 2 },  { 0, 0 }, RDIM/2 },
+    { BOOTSTRAP_KEY_SET, "02", {CKKSRNS_SCHEME, RDIM, MULT_DEPTH, SMODSIZE,  DFLT,  DFLT,     UNIFORM_TERNARY, DFLT, FMODSIZE, HEStd_NotSet, HYBRID,       FIXEDAUTO, NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,   DFLT,  DFLT,   DFLT,      DFLT, DFLT, DFLT, REAL},   { 1, 1 },  { 0, 0 }, RDIM/2 },
+    { BOOTSTRAP_KEY_SET, "03", {CKKSRNS_SCHEME, RDIM, MULT_DEPTH, SMODSIZE,  DFLT,  DFLT,      SPARSE_TERNARY, DFLT, FMODSIZE, HEStd_NotSet, HYBRID,       FIXEDAUTO, NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,   DFLT,  DFLT,   DFLT,      DFLT, DFLT, DFLT, COMPLEX},   { 2, 2 },  { 0, 0 }, RDIM/2 },
+    { BOOTSTRAP_KEY_SET, "04", {CKKSRNS_SCHEME, RDIM, MULT_DEPTH, SMODSIZE,  DFLT,  DFLT,     UNIFORM_TERNARY, DFLT, FMODSIZE, HEStd_NotSet, HYBRID,     FIXEDMANUAL, NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,   DFLT,  DFLT,   DFLT,      DFLT, DFLT, DFLT, REAL},   { 2, 2 },  { 0, 0 }, RDIM/2 },
+    // ==========================================
     // TestType,                    Descr,          Scheme,    RDim, MultDepth, SModSize, DSize, BSize, SecKeyDist, MaxRelinSkDeg, FModSize,       SecLvl, KSTech,    ScalTech,      LDigits, PtMod,StdDev, EvalAddCt, KSCt, MultTech, EncTech, PREMode, MultipartyMode, decryptionNoiseMode, ExecutionMode, NoiseEstimate, RegisterWordSize, CompositeDegree, CKKSDataType, LvlBudget, Dim1,       Slots
     { BOOTSTRAP_SPARSE_ENCAPSULATED, "01", {CKKSRNS_SCHEME, 1 << 12,        18,       50,  DFLT,  DFLT, SPARSE_ENCAPSULATED, DFLT,       60, HEStd_NotSet, HYBRID,   FIXEDAUTO, NUM_LRG_DIGS,  DFLT,  DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,           DFLT,  DFLT,   DFLT,      DFLT, DFLT, DFLT, REAL},   { 4, 4 },  { 8, 8 }, 8 },
     { BOOTSTRAP_SPARSE_ENCAPSULATED, "02", {CKKSRNS_SCHEME, 1 << 12,        18,       50,  DFLT,  DFLT, SPARSE_ENCAPSULATED, DFLT,       60, HEStd_NotSet, HYBRID, FIXEDMANUAL, NUM_LRG_DIGS,  DFLT,  DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,           DFLT,  DFLT,   DFLT,      DFLT, DFLT, DFLT, REAL},   { 4, 4 },  { 8, 8 }, 8 },
@@ -416,7 +456,8 @@ protected:
         try {
             CryptoContext<Element> cc(UnitTestGenerateContext(testData.params));
 
-            cc->EvalBootstrapSetup(testData.levelBudget, testData.dim1, testData.slots, 0, true, StCFlag);
+            cc->EvalBootstrapSetup(testData.levelBudget, testData.dim1, testData.slots, 0, true, StCFlag,
+                                   testData.testCaseType == BOOTSTRAP_COMPACT);
 
             auto keyPair = cc->KeyGen();
             cc->EvalBootstrapKeyGen(keyPair.secretKey, testData.slots);
@@ -803,6 +844,208 @@ protected:
         }
     }
 
+    void UnitTest_Bootstrap_PrecomputeSerialize(const TEST_CASE_UTCKKSRNS_BOOT& testData, const bool StCFlag,
+                                                const std::string& failmsg = std::string()) {
+        try {
+            CryptoContextImpl<DCRTPoly>::ClearEvalMultKeys();
+            CryptoContextImpl<DCRTPoly>::ClearEvalSumKeys();
+            CryptoContextImpl<DCRTPoly>::ClearEvalAutomorphismKeys();
+            CryptoContextFactory<DCRTPoly>::ReleaseAllContexts();
+
+            CryptoContext<Element> ccInit(UnitTestGenerateContext(testData.params));
+            ccInit->EvalBootstrapSetup(testData.levelBudget, testData.dim1, testData.slots, 0, true, StCFlag);
+
+            auto keyPairInit = ccInit->KeyGen();
+            ccInit->EvalMultKeyGen(keyPairInit.secretKey);
+            ccInit->EvalBootstrapKeyGen(keyPairInit.secretKey, testData.slots);
+
+            auto precomInit = ccInit->ExportBootstrapPrecompute(testData.slots);
+            EXPECT_EQ(precomInit->m_fingerprint, ccInit->GetBootstrapPrecomputeFingerprint(
+                                                     testData.levelBudget, testData.dim1, testData.slots, StCFlag))
+                << failmsg;
+            //==============================================================
+            // Serialize all necessary objects
+            std::stringstream cc_stream;
+            Serial::Serialize(ccInit, cc_stream, SerType::BINARY);
+
+            std::stringstream secretKey_stream;
+            Serial::Serialize(keyPairInit.secretKey, secretKey_stream, SerType::BINARY);
+
+            std::stringstream publicKey_stream;
+            Serial::Serialize(keyPairInit.publicKey, publicKey_stream, SerType::BINARY);
+
+            std::stringstream automorphismKey_stream;
+            CryptoContextImpl<DCRTPoly>::SerializeEvalAutomorphismKey(automorphismKey_stream, SerType::BINARY);
+
+            std::stringstream evalMultKey_stream;
+            CryptoContextImpl<DCRTPoly>::SerializeEvalMultKey(evalMultKey_stream, SerType::BINARY);
+
+            std::stringstream precom_stream;
+            Serial::Serialize(*precomInit, precom_stream, SerType::BINARY);
+            //====================================================================================================
+            // Removed the serialized objects from the memory
+            precomInit.reset();
+            CryptoContextImpl<DCRTPoly>::ClearEvalMultKeys();
+            CryptoContextImpl<DCRTPoly>::ClearEvalSumKeys();
+            CryptoContextImpl<DCRTPoly>::ClearEvalAutomorphismKeys();
+            CryptoContextFactory<DCRTPoly>::ReleaseAllContexts();
+            //====================================================================================================
+            // Deserialize all necessary objects. The precomputations are imported instead of being recomputed
+            CryptoContext<Element> cc;
+            Serial::Deserialize(cc, cc_stream, SerType::BINARY);
+
+            KeyPair<Element> keyPair;
+            Serial::Deserialize(keyPair.secretKey, secretKey_stream, SerType::BINARY);
+            Serial::Deserialize(keyPair.publicKey, publicKey_stream, SerType::BINARY);
+            CryptoContextImpl<DCRTPoly>::DeserializeEvalAutomorphismKey(automorphismKey_stream, SerType::BINARY);
+            CryptoContextImpl<DCRTPoly>::DeserializeEvalMultKey(evalMultKey_stream, SerType::BINARY);
+
+            CKKSBootstrapPrecomData precom;
+            Serial::Deserialize(precom, precom_stream, SerType::BINARY);
+            cc->ImportBootstrapPrecompute(precom);
+            //====================================================================================================
+            // If CKKSDataType is set to REAL, the imaginary parts are ignored.
+            auto input(Fill({0.111111 + 0.999999i, 0.222222 - 0.888888i, 0.333333 + 0.777777i, 0.444444 - 0.666666i,
+                             0.555555 + 0.555555i, 0.666666 - 0.444444i, 0.777777 + 0.333333i, 0.888888 - 0.222222i},
+                            testData.slots));
+            size_t encodedLength = input.size();
+
+            Plaintext plaintext1 = cc->MakeCKKSPackedPlaintext(
+                input, 1, MULT_DEPTH - 1 - testData.levelBudget[1] * StCFlag, nullptr, testData.slots);
+            auto ciphertext1      = cc->Encrypt(keyPair.publicKey, plaintext1);
+            auto ciphertext1After = cc->EvalBootstrap(ciphertext1);
+
+            Plaintext result;
+            cc->Decrypt(keyPair.secretKey, ciphertext1After, &result);
+            result->SetLength(encodedLength);
+            plaintext1->SetLength(encodedLength);
+            checkEquality(result->GetCKKSPackedValue(), plaintext1->GetCKKSPackedValue(), eps,
+                          failmsg + " Bootstrapping with imported precomputations fails for " +
+                              ((StCFlag) ? "StC-first" : "ModRaise-first") + " version.");
+            //====================================================================================================
+            // precomputations generated for another level budget must be rejected
+            precom.m_lvlbEnc = (precom.m_lvlbEnc == 1) ? 2 : 1;
+            EXPECT_THROW(cc->ImportBootstrapPrecompute(precom), OpenFHEException) << failmsg;
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            UNIT_TEST_HANDLE_ALL_EXCEPTIONS;
+        }
+    }
+
+    void UnitTest_Bootstrap_Batch(const TEST_CASE_UTCKKSRNS_BOOT& testData, const bool StCFlag,
+                                  const std::string& failmsg = std::string()) {
+        try {
+            CryptoContext<Element> cc(UnitTestGenerateContext(testData.params));
+
+            cc->EvalBootstrapSetup(testData.levelBudget, testData.dim1, testData.slots, 0, true, StCFlag);
+
+            auto keyPair = cc->KeyGen();
+            cc->EvalBootstrapKeyGen(keyPair.secretKey, testData.slots);
+            cc->EvalMultKeyGen(keyPair.secretKey);
+
+            // If CKKSDataType is set to REAL, the imaginary parts are ignored.
+            auto input(Fill({0.111111 + 0.999999i, 0.222222 - 0.888888i, 0.333333 + 0.777777i, 0.444444 - 0.666666i,
+                             0.555555 + 0.555555i, 0.666666 - 0.444444i, 0.777777 + 0.333333i, 0.888888 - 0.222222i},
+                            testData.slots));
+            size_t encodedLength = input.size();
+
+            // ciphertexts with different messages and levels are bootstrapped together
+            const uint32_t batchSize = 3;
+            std::vector<Plaintext> plaintexts(batchSize);
+            std::vector<Ciphertext<Element>> ciphertexts(batchSize);
+            for (uint32_t i = 0; i < batchSize; ++i) {
+                std::rotate(input.begin(), input.begin() + 1, input.end());
+                plaintexts[i] = cc->MakeCKKSPackedPlaintext(
+                    input, 1, MULT_DEPTH - 1 - i - testData.levelBudget[1] * StCFlag, nullptr, testData.slots);
+                ciphertexts[i] = cc->Encrypt(keyPair.publicKey, plaintexts[i]);
+            }
+            auto ciphertextsAfter = cc->EvalBootstrapBatch(ciphertexts);
+            ASSERT_EQ(ciphertextsAfter.size(), batchSize) << failmsg;
+
+            for (uint32_t i = 0; i < batchSize; ++i) {
+                Plaintext result;
+                cc->Decrypt(keyPair.secretKey, ciphertextsAfter[i], &result);
+                result->SetLength(encodedLength);
+                plaintexts[i]->SetLength(encodedLength);
+                checkEquality(result->GetCKKSPackedValue(), plaintexts[i]->GetCKKSPackedValue(), eps,
+                              failmsg + " Batched bootstrapping fails for ciphertext " + std::to_string(i) + " in " +
+                                  ((StCFlag) ? "StC-first" : "ModRaise-first") + " version.");
+            }
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            UNIT_TEST_HANDLE_ALL_EXCEPTIONS;
+        }
+    }
+
+    void UnitTest_Bootstrap_KeySet(const TEST_CASE_UTCKKSRNS_BOOT& testData, const bool StCFlag,
+                                   const std::string& failmsg = std::string()) {
+        try {
+            CryptoContext<Element> cc(UnitTestGenerateContext(testData.params));
+
+            // bootstrapping is set up for testData.slots and for two smaller numbers of slots
+            std::vector<CKKSBootstrapConfig> configs;
+            std::vector<uint32_t> slots;
+            for (uint32_t s = testData.slots; s >= testData.slots / 4; s >>= 1) {
+                configs.push_back({s, testData.levelBudget, testData.dim1});
+                slots.push_back(s);
+            }
+            const size_t numDefaultIndices = cc->GetBootstrapRotationIndices(configs).size();
+
+            auto planned = cc->EvalBootstrapSetup(configs, 0, true, StCFlag);
+            ASSERT_EQ(planned.size(), configs.size()) << failmsg;
+            const size_t numPlannedIndices = cc->GetBootstrapRotationIndices(planned).size();
+            EXPECT_LE(numPlannedIndices, numDefaultIndices) << failmsg << " The planned key set is larger.";
+
+            auto keyPair = cc->KeyGen();
+            cc->EvalBootstrapKeyGen(keyPair.secretKey, slots);
+            cc->EvalMultKeyGen(keyPair.secretKey);
+
+            // one key per planned rotation index plus the conjugation key
+            EXPECT_EQ(cc->GetEvalAutomorphismKeyMap(keyPair.secretKey->GetKeyTag()).size(), numPlannedIndices + 1)
+                << failmsg;
+
+            for (const auto& config : planned) {
+                // If CKKSDataType is set to REAL, the imaginary parts are ignored.
+                auto input(
+                    Fill({0.111111 + 0.999999i, 0.222222 - 0.888888i, 0.333333 + 0.777777i, 0.444444 - 0.666666i,
+                          0.555555 + 0.555555i, 0.666666 - 0.444444i, 0.777777 + 0.333333i, 0.888888 - 0.222222i},
+                         config.slots));
+                size_t encodedLength = input.size();
+
+                Plaintext plaintext = cc->MakeCKKSPackedPlaintext(
+                    input, 1, MULT_DEPTH - 1 - testData.levelBudget[1] * StCFlag, nullptr, config.slots);
+                auto ciphertextAfter = cc->EvalBootstrap(cc->Encrypt(keyPair.publicKey, plaintext));
+
+                Plaintext result;
+                cc->Decrypt(keyPair.secretKey, ciphertextAfter, &result);
+                result->SetLength(encodedLength);
+                plaintext->SetLength(encodedLength);
+                checkEquality(result->GetCKKSPackedValue(), plaintext->GetCKKSPackedValue(), eps,
+                              failmsg + " Bootstrapping with the planned key set fails for " +
+                                  std::to_string(config.slots) + " slots in " +
+                                  ((StCFlag) ? "StC-first" : "ModRaise-first") + " version.");
+            }
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            UNIT_TEST_HANDLE_ALL_EXCEPTIONS;
+        }
+    }
+
     void UnitTest_BootstrapSE(const TEST_CASE_UTCKKSRNS_BOOT& testData, const std::string& failmsg = std::string()) {
         try {
             CryptoContext<Element> cc(UnitTestGenerateContext(testData.params));
@@ -860,6 +1103,7 @@ TEST_P(UTCKKSRNS_BOOT, CKKSRNS) {
         case BOOTSTRAP_FULL:
         case BOOTSTRAP_EDGE:
         case BOOTSTRAP_SPARSE:
+        case BOOTSTRAP_COMPACT:
             UnitTest_Bootstrap(test, false, test.buildTestName());
             UnitTest_Bootstrap(test, true, test.buildTestName());
             break;
@@ -881,6 +1125,18 @@ TEST_P(UTCKKSRNS_BOOT, CKKSRNS) {
         case BOOTSTRAP_SPARSE_ENCAPSULATED:
             UnitTest_BootstrapSE(test, test.buildTestName());
             break;
+        case BOOTSTRAP_PRECOMPUTE_SERIALIZE:
+            UnitTest_Bootstrap_PrecomputeSerialize(test, false, test.buildTestName());
+            UnitTest_Bootstrap_PrecomputeSerialize(test, true, test.buildTestName());
+            break;
+        case BOOTSTRAP_BATCH:
+            UnitTest_Bootstrap_Batch(test, false, test.buildTestName());
+            UnitTest_Bootstrap_Batch(test, true, test.buildTestName());
+            break;
+        case BOOTSTRAP_KEY_SET:
+            UnitTest_Bootstrap_KeySet(test, false, test.buildTestName());
+            UnitTest_Bootstrap_KeySet(test, true, test.buildTestName());
+            break;
         default:
             break;
     }